@@ -42,6 +42,7 @@
 
 import m5
 from m5.objects import *
+from m5.util import warn
 from common.Caches import *
 from common import ObjectList
 
@@ -69,6 +70,10 @@ def _get_cache_opts(level, options):
 
     return opts
 
+def _uses_eventq_boundaries(options):
+    return getattr(options, 'parallel_eventqs', False) or \
+        getattr(options, 'eventq_boundaries_only', False)
+
 def config_cache(options, system):
     if options.external_memory_system and (options.caches or options.l2cache):
         print("External caches and internal caches are exclusive options.\n")
@@ -171,17 +176,39 @@ def config_cache(options, system):
             system.l3.cpu_side = system.tol3bus.mem_side_ports
             system.l3.mem_side = system.membus.cpu_side_ports
 
+        if _uses_eventq_boundaries(options):
+            # Per-core L2s and the shared levels below may run on different
+            # event queues; cross through a boundary. The event queue
+            # indices are assigned by XSConfig.config_parallel_eventqs.
+            system.eventq_boundaries = [EventQueueBoundary(
+                cpu_side_eventq_index=0) for i in range(options.num_cpus)]
+            l2_mem_sides = []
+            for i in range(options.num_cpus):
+                system.l2_caches[i].mem_side = \
+                    system.eventq_boundaries[i].cpu_side_port
+                l2_mem_sides.append(system.eventq_boundaries[i].mem_side_port)
+        else:
+            l2_mem_sides = [l2.mem_side for l2 in system.l2_caches]
+
         for i in range(options.num_cpus):
             if options.l3cache:
                 # l2 -> tol3bus -> l3
-                system.l2_caches[i].mem_side = system.tol3bus.cpu_side_ports
+                system.tol3bus.cpu_side_ports = l2_mem_sides[i]
                 # l3 -> membus
             else:
-                system.l2_caches[i].mem_side = system.membus.cpu_side_ports
+                system.membus.cpu_side_ports = l2_mem_sides[i]
 
     if options.memchecker:
         system.memchecker = MemChecker()
 
+    l2_to_l3_pf_hint = options.l3cache and options.l2_to_l3_pf_hint
+    if l2_to_l3_pf_hint and _uses_eventq_boundaries(options):
+        # the hints are direct calls into the shared L3 prefetcher, which
+        # lives on another event queue
+        warn("L2 to L3 prefetch hints are dropped across event queue "
+             "boundaries")
+        l2_to_l3_pf_hint = False
+
     for i in range(options.num_cpus):
         if options.caches:
             icache = icache_class(**_get_cache_opts('l1i', options))
@@ -224,7 +251,7 @@ def config_cache(options, system):
                 system.l2_caches[i].prefetcher.queue_size = 64
                 system.l2_caches[i].prefetcher.max_prefetch_requests_with_pending_translation = 128
 
-            if options.l3cache and options.l2_to_l3_pf_hint:
+            if l2_to_l3_pf_hint:
                 assert system.l2_caches[i].prefetcher != NULL and \
                     system.l3.prefetcher != NULL
                 system.l2_caches[i].prefetcher.add_pf_downstream(system.l3.prefetcher)
@@ -259,6 +259,7 @@ def config_mem(options, system):
         mem_ctrls[i].nvm = nvm_intfs[i];
 
     # Connect the controller to the xbar port
+    mem_bridges = []
     for i in range(len(mem_ctrls)):
         if opt_mem_type == "HMC_2500_1x32":
             # Connect the controllers to the membus
@@ -266,6 +267,14 @@ def config_mem(options, system):
             # Set memory device size. There is an independent controller
             # for each vault. All vaults are same size.
             mem_ctrls[i].dram.device_size = options.hmc_dev_vault_size
+        elif getattr(options, 'mem_eventq', False):
+            # The controllers run on an event queue of their own, see
+            # XSConfig.config_parallel_eventqs
+            bridge = m5.objects.CrossQueueBridge(
+                cpu_side_eventq_index=0, delay=options.sim_quantum)
+            bridge.cpu_side_port = xbar.mem_side_ports
+            mem_ctrls[i].port = bridge.mem_side_port
+            mem_bridges.append(bridge)
         else:
             # Connect the controllers to the membus
             mem_ctrls[i].port = xbar.mem_side_ports
@@ -281,3 +290,5 @@ def config_mem(options, system):
                   '128GiB/s to model an ideal cache')
 
     subsystem.mem_ctrls = mem_ctrls
+    if mem_bridges:
+        subsystem.mem_bridges = mem_bridges
@@ -201,6 +201,17 @@ def addNoISAOptions(parser, configure_xiangshan=False):
                         help="dump commit instructions from this committed number")
     parser.add_argument("--dump-loop-pred", action='store_true', default=False,
             help="Dump loop predictor logs at exit")
+    parser.add_argument("--pipe-trace", action="store", type=str,
+                        default=None, metavar="FILE",
+                        help="Write the pipeline stages of the instructions "
+                        "committed by cpu N to cpuN.FILE in the output "
+                        "directory, gzip compressed if FILE ends with .gz. "
+                        "Convert it with util/o3-pipetrace.py")
+    parser.add_argument("--idle-cycle-skip", action="store_true",
+                        help="Let O3 CPUs deschedule themselves over cycles "
+                        "in which they only wait on a load miss at the ROB "
+                        "head. Checked against the unskipped run by "
+                        "util/xs_scripts/idle_skip_regression.sh")
 
     # ArchDB option
     parser.add_argument("--enable-arch-db",
@@ -319,6 +330,12 @@ def addCommonOptions(parser, configure_xiangshan=False):
         default=20*10**6,
         help="Warmup period in total instructions, reset stats without switch")
 
+    parser.add_argument("--functional-warmup-insts", action="store", type=int,
+        default=None,
+        help="Before the detailed cores start, execute at least <N> "
+        "instructions per core on atomic CPUs that warm the caches, the TLBs "
+        "and the branch predictors of the detailed cores")
+
     parser.add_argument(
         "--stats-root", action="append", default=[],
         help="If given, dump only stats of objects under the given SimObject. "
@@ -628,6 +645,36 @@ def addXiangshanFSOptions(parser):
     parser.add_argument("--raw-cpt", action= "store_true",
                         help = "The checkpoint file is not gz but binary")
 
+    parser.add_argument("--save-warm-state", action="store", type=str,
+                        nargs="?", const="", default=None, metavar="PATH",
+                        help="When the warmup ends, save the caches, "
+                        "prefetcher and branch predictor tables to PATH, "
+                        "by default a .warm.gz file next to the checkpoint. "
+                        "TLBs are not saved and warm in the measured run")
+    parser.add_argument("--load-warm-state", action="store", type=str,
+                        nargs="?", const="", default=None, metavar="PATH",
+                        help="Start from the caches, prefetcher and branch "
+                        "predictor tables saved by --save-warm-state, "
+                        "by default from the file next to the checkpoint")
+    parser.add_argument("--fork-sweep", action="store", type=str,
+                        default=None, metavar="FILE",
+                        help="When the warmup ends, fork one child per line "
+                        "of FILE and let each finish the run with its own "
+                        "settings. A line holds an output directory name and "
+                        "python statements run in the child, e.g. "
+                        "\"no_berti system.cpu[0].dcache.prefetcher"
+                        ".setComponentEnabled('berti', False)\"")
+
+    parser.add_argument("--populate-shared-cpt", action="store", type=str,
+                        default=None, metavar="NAME",
+                        help="Restore the checkpoint into the shared memory "
+                        "segment NAME (/dev/shm/NAME) and exit")
+    parser.add_argument("--map-shared-cpt", action="store", type=str,
+                        default=None, metavar="NAME",
+                        help="Start from the checkpoint restored by "
+                        "--populate-shared-cpt, mapped copy-on-write, instead "
+                        "of decompressing it again")
+
     parser.add_argument("--mmc-img", action="store", type=str,
                         default=None, help="The path of mmc img")
     parser.add_argument("--mmc-cptbin", action="store",
@@ -643,3 +690,24 @@ def addXiangshanFSOptions(parser):
                         default=None,
                         help="The shared lib file used to do difftest")
 
+    # Parallel simulation options
+    parser.add_argument("--parallel-eventqs", action="store_true",
+                        help="Simulate each core and its private caches on "
+                        "an event queue and host thread of its own; shared "
+                        "caches, buses and devices stay on event queue 0")
+    parser.add_argument("--eventq-boundaries-only", action="store_true",
+                        help="Insert the per-core event queue boundaries of "
+                        "--parallel-eventqs but keep every object on event "
+                        "queue 0, as a serial reference run whose stats "
+                        "match the parallel run with the same --sim-quantum")
+    parser.add_argument("--sim-quantum", action="store", type=str,
+                        default="1ns",
+                        help="Synchronization quantum of the event queues; "
+                        "packets cross the per-core boundaries at quantum "
+                        "barriers. 1ps (one tick) gives the closest timing "
+                        "to a run without boundaries")
+    parser.add_argument("--mem-eventq", action="store_true",
+                        help="With --parallel-eventqs, also run the memory "
+                        "controllers on an event queue of their own, behind "
+                        "lock-free bridges that add --sim-quantum of latency")
+
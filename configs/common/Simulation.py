@@ -37,6 +37,7 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import os
 import sys
 from os import getcwd
 from os.path import join as joinpath
@@ -264,10 +265,82 @@ def scriptCheckpoints(options, maxtick, cptdir):
 
     return exit_event
 
+def warmStatePath(options, path):
+    """Path of a warm state snapshot, next to the checkpoint unless given
+    explicitly."""
+    if path:
+        return path
+    base = options.generic_rv_cpt
+    for ext in ('.gz', '.zstd'):
+        if base.endswith(ext):
+            base = base[:-len(ext)]
+            break
+    return base + '.warm.gz'
+
+def readForkSweep(path):
+    """Parse a fork sweep file into (name, statements) pairs. Blank lines
+    and lines starting with # are skipped."""
+    configs = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            name, _, stmts = line.partition(' ')
+            if any(name == n for n, _ in configs):
+                fatal("Fork sweep config %s is listed twice", name)
+            configs.append((name, stmts.strip()))
+    if not configs:
+        fatal("Fork sweep file %s has no configs", path)
+    return configs
+
+def forkSweep(testsys, options):
+    """Fork one child per config of --fork-sweep from the current, warmed
+    state. Children share the memory of the parent copy-on-write, apply
+    their settings and return to finish the run, with stats and traces in
+    outdir/<name>. The parent waits for all of them and exits."""
+    configs = readForkSweep(options.fork_sweep)
+    outdir = os.path.abspath(m5.options.outdir)
+
+    # forked processes must not fight over the listener ports
+    m5.disableAllListeners()
+
+    children = {}
+    for name, stmts in configs:
+        pid = m5.fork(os.path.join(outdir, name))
+        if pid == 0:
+            # files written to the cwd, such as bp.db, stay per child too
+            os.chdir(m5.options.outdir)
+            print("Fork sweep config %s: %s" % (name, stmts or "(baseline)"))
+            if stmts:
+                exec(stmts, {'m5': m5, 'system': testsys,
+                             'root': Root.getInstance()})
+            return
+        children[pid] = name
+
+    failed = []
+    while children:
+        pid, status = os.waitpid(-1, 0)
+        name = children.pop(pid)
+        if not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+            failed.append(name)
+    print("Fork sweep: %d configs finished, %d failed%s" %
+          (len(configs) - len(failed), len(failed),
+           (": " + " ".join(failed)) if failed else ""))
+    sys.exit(1 if failed else 0)
+
 def benchCheckpoints(testsys, options, maxtick, cptdir):
     exit_event = m5.simulate(maxtick - m5.curTick())
     exit_cause = exit_event.getCause()
+    save_warm_state = getattr(options, 'save_warm_state', None)
+    fork_sweep = getattr(options, 'fork_sweep', None)
     while exit_cause == "Will trigger stat dump and reset":
+        if save_warm_state is not None:
+            m5.saveWarmState(warmStatePath(options, save_warm_state))
+            save_warm_state = None
+        if fork_sweep is not None:
+            forkSweep(testsys, options)
+            fork_sweep = None
         if options.enable_arch_db:
             print("into start_recording")
             testsys.arch_db.start_recording()
@@ -771,6 +844,30 @@ def run(options, root, testsys, cpu_class):
     if exit_event.getCode() != 0:
         print("Simulated exit code not 0! Exit code is", exit_event.getCode())
 
+def functionalWarmup(testsys, options):
+    """Switch the atomic warmup CPUs in for --functional-warmup-insts
+    instructions, then hand the warmed caches, TLBs and predictors back to
+    the detailed cores. Returns the exit event if the simulation ended
+    during the warmup, None otherwise."""
+    np = options.num_cpus
+    warmup_cpu_list = [(testsys.cpu[i], testsys.warmup_cpus[i])
+                       for i in range(np)]
+    m5.switchCpus(testsys, warmup_cpu_list)
+
+    print("**** FUNCTIONAL WARMUP ****")
+    # every warmup CPU exits once when it reaches the count, the ones that
+    # got there first keep warming up until the last one does
+    for _ in range(np):
+        exit_event = m5.simulate()
+        if exit_event.getCause() != \
+                "all threads reached the max instruction count":
+            return exit_event
+
+    print("Functional warmup done @ tick %i" % m5.curTick())
+    m5.switchCpus(testsys, [(new_cpu, old_cpu)
+                            for old_cpu, new_cpu in warmup_cpu_list])
+    return None
+
 def run_vanilla(options, root, testsys, cpu_class):
     # Setup global stat filtering.
     stat_root_simobjs = []
@@ -823,6 +920,14 @@ def run_vanilla(options, root, testsys, cpu_class):
     root.apply_config(options.param)
     m5.instantiate(checkpoint_dir)
 
+    if getattr(options, 'populate_shared_cpt', None):
+        print("Checkpoint restored into shared memory segment %s" %
+              options.populate_shared_cpt)
+        sys.exit(0)
+
+    if getattr(options, 'load_warm_state', None) is not None:
+        m5.loadWarmState(warmStatePath(options, options.load_warm_state))
+
     # Handle the max tick settings now that tick frequency was resolved
     # during system instantiation
     # NOTE: the maxtick variable here is in absolute ticks, so it must
@@ -843,11 +948,21 @@ def run_vanilla(options, root, testsys, cpu_class):
              " Using least")
     maxtick = min([maxtick_from_abs, maxtick_from_rel, maxtick_from_maxtime])
 
-    print("**** REAL SIMULATION ****")
+    exit_event = None
+    if getattr(options, 'functional_warmup_insts', None):
+        exit_event = functionalWarmup(testsys, options)
+        # without a detailed warmup, the snapshot is taken right here
+        if exit_event is None and not options.warmup_insts_no_switch and \
+                getattr(options, 'save_warm_state', None) is not None:
+            m5.saveWarmState(warmStatePath(options, options.save_warm_state))
 
-    # If checkpoints are being taken, then the checkpoint instruction
-    # will occur in the benchmark code it self.
-    exit_event = benchCheckpoints(testsys, options, maxtick, cptdir=None)
+    if exit_event is None:
+        print("**** REAL SIMULATION ****")
+
+        # If checkpoints are being taken, then the checkpoint instruction
+        # will occur in the benchmark code it self.
+        exit_event = benchCheckpoints(testsys, options, maxtick,
+                                      cptdir=None)
 
     print('Exiting @ tick %i because %s' %
           (m5.curTick(), exit_event.getCause()))
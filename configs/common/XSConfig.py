@@ -93,6 +93,20 @@ def config_xiangshan_inputs(args: argparse.Namespace, sys):
         else:
             sys.gcpt_restorer_file = gcpt_restorer
 
+    # one decompressed image in shared memory, many runs mapping it
+    if args.populate_shared_cpt or args.map_shared_cpt:
+        if args.populate_shared_cpt and args.map_shared_cpt:
+            fatal("--populate-shared-cpt and --map-shared-cpt are exclusive")
+        if args.raw_cpt:
+            fatal("A raw checkpoint is already mapped from its file, "
+                  "it cannot be shared through /dev/shm")
+        if args.enable_difftest and args.num_cpus > 1:
+            fatal("Multi-core difftest deduplicates memory on its own, "
+                  "it cannot use a shared checkpoint")
+        sys.shared_backstore = \
+            args.populate_shared_cpt or args.map_shared_cpt
+        sys.shared_backstore_cow = bool(args.map_shared_cpt)
+
     # configure DRAMSim input
     if args.mem_type == 'DRAMsim3' and args.dramsim3_ini is None:
         home = None
@@ -119,3 +133,90 @@ def config_difftest(cpu_list, args, sys):
             # cpu_list[0].enable_mem_dedup = True
             cpu_list[0].enable_difftest = True
             cpu_list[0].difftest_ref_so = args.difftest_ref_so
+
+
+def config_functional_warmup(args, sys):
+    """Add a switched out atomic CPU next to every detailed core.
+
+    Simulation.run_vanilla switches them in first for
+    --functional-warmup-insts instructions. They run in atomic mode through
+    the cores' own caches and hand their TLB entries over when switched
+    out; every control instruction they commit also trains the branch
+    predictor of the switched out core.
+    """
+    if not args.functional_warmup_insts:
+        return
+    if getattr(args, 'ruby', False):
+        fatal("Functional warmup runs in atomic mode, which Ruby does not "
+              "support")
+    if args.parallel_eventqs:
+        fatal("Functional warmup cannot be combined with --parallel-eventqs")
+
+    sys.warmup_cpus = [AtomicSimpleCPU(switched_out=True, cpu_id=i)
+                       for i in range(len(sys.cpu))]
+    for cpu, warm_cpu in zip(sys.cpu, sys.warmup_cpus):
+        warm_cpu.system = sys
+        warm_cpu.workload = cpu.workload
+        warm_cpu.clk_domain = cpu.clk_domain
+        warm_cpu.isa = cpu.isa
+        warm_cpu.mmu.pma_checker = PMAChecker(
+            uncacheable=cpu.mmu.pma_checker.uncacheable)
+        warm_cpu.enable_riscv_vector = cpu.enable_riscv_vector
+        warm_cpu.max_insts_all_threads = args.functional_warmup_insts
+        warm_cpu.warmupBranchPred = cpu.branchPred
+        warm_cpu.createThreads()
+
+
+def config_parallel_eventqs(args, sys, root):
+    """Give every core, with its L1s and L2, an event queue of its own.
+
+    The L3, buses, memory and devices stay on event queue 0. Ports between
+    the two sides go through the EventQueueBoundary objects inserted by
+    CacheConfig.config_cache; everything below a core inherits its
+    eventq_index through the Parent proxy. With --mem-eventq the memory
+    controllers move to one more queue, reached through the
+    CrossQueueBridges inserted by MemConfig.config_mem.
+
+    --eventq-boundaries-only keeps everything on queue 0 but crosses the
+    boundaries at the same quanta, so its stats are the reference for the
+    parallel run with the same --sim-quantum.
+    """
+    if args.mem_eventq and not args.parallel_eventqs:
+        fatal("--mem-eventq requires --parallel-eventqs")
+    if not (args.parallel_eventqs or args.eventq_boundaries_only):
+        return
+    if args.parallel_eventqs and args.eventq_boundaries_only:
+        fatal("--parallel-eventqs and --eventq-boundaries-only are "
+              "exclusive options")
+    if getattr(args, 'ruby', False):
+        fatal("Parallel event queues need the classic memory system, Ruby "
+              "keeps shared network state")
+    if args.parallel_eventqs and args.enable_arch_db:
+        fatal("The arch db is shared by all cores and cannot be used with "
+              "--parallel-eventqs")
+    if args.parallel_eventqs and args.enable_difftest:
+        fatal("Difftest drives a reference model shared by all cores and "
+              "cannot be used with --parallel-eventqs")
+
+    for i, cpu in enumerate(sys.cpu):
+        eq = i + 1 if args.parallel_eventqs else 0
+        cpu.eventq_index = eq
+        sys.l2_caches[i].eventq_index = eq
+        sys.tol2bus_list[i].eventq_index = eq
+        sys.eventq_boundaries[i].cpu_side_eventq_index = eq
+
+    if args.mem_eventq:
+        mem_eq = len(sys.cpu) + 1
+        for ctrl, bridge in zip(sys.mem_ctrls, sys.mem_bridges):
+            ctrl.eventq_index = mem_eq
+            bridge.eventq_index = mem_eq
+
+    # the boundaries cross at quantum barriers in the serial reference run
+    # too, so that both runs move the same packets at the same ticks
+    m5.ticks.fixGlobalFrequency()
+    root.sim_quantum = m5.ticks.fromSeconds(
+        m5.util.convert.anyToLatency(args.sim_quantum))
+    print("Running %d cores on %s event queues with a %s quantum"
+          % (len(sys.cpu),
+             "parallel" if args.parallel_eventqs else "one",
+             args.sim_quantum))
@@ -252,6 +252,10 @@ def build_test_system(np):
         else:
             test_sys.cpu[i].dump_commit = False
             test_sys.cpu[i].dump_start = 0
+        if args.pipe_trace:
+            test_sys.cpu[i].pipe_trace_file = 'cpu%d.%s' % (i, args.pipe_trace)
+        if args.idle_cycle_skip:
+            test_sys.cpu[i].idleCycleSkip = True
 
     return test_sys
 
@@ -267,7 +271,10 @@ if '--ruby' in sys.argv:
 args = parser.parse_args()
 
 args.xiangshan_system = True
-args.enable_difftest = True
+# difftest cannot follow cores on parallel event queues; the serial
+# reference of such a run goes without it as well
+args.enable_difftest = args.enable_difftest or \
+    not (args.parallel_eventqs or args.eventq_boundaries_only)
 args.enable_riscv_vector = True
 
 assert not args.external_memory_system
@@ -290,4 +297,8 @@ test_sys = build_test_system(args.num_cpus)
 
 root = Root(full_system=True, system=test_sys)
 
+XSConfig.config_parallel_eventqs(args, test_sys, root)
+
+XSConfig.config_functional_warmup(args, test_sys)
+
 Simulation.run_vanilla(args, root, test_sys, FutureClass)
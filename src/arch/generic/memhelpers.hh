@@ -54,7 +54,7 @@ template <class XC>
 Fault
 initiateMemRead(XC *xc, Addr addr, std::size_t size,
                 Request::Flags flags,
-                const std::vector<bool> &byte_enable)
+                const ByteEnable &byte_enable)
 {
     return xc->initiateMemRead(addr, size, flags, byte_enable);
 }
@@ -67,7 +67,7 @@ Fault
 initiateMemRead(XC *xc, Trace::InstRecord *traceData, Addr addr,
                 MemT &mem, Request::Flags flags)
 {
-    static const std::vector<bool> byte_enable(sizeof(MemT), true);
+    static const ByteEnable byte_enable(sizeof(MemT), true);
     return initiateMemRead(xc, addr, sizeof(MemT),
                            flags, byte_enable);
 }
@@ -101,7 +101,7 @@ template <class XC>
 Fault
 readMemAtomic(XC *xc, Addr addr, uint8_t *mem,
               std::size_t size, Request::Flags flags,
-              const std::vector<bool> &byte_enable)
+              const ByteEnable &byte_enable)
 {
     return xc->readMem(addr, mem, size, flags, byte_enable);
 }
@@ -113,7 +113,7 @@ readMemAtomic(XC *xc, Trace::InstRecord *traceData, Addr addr, MemT &mem,
               Request::Flags flags)
 {
     memset(&mem, 0, sizeof(mem));
-    static const std::vector<bool> byte_enable(sizeof(MemT), true);
+    static const ByteEnable byte_enable(sizeof(MemT), true);
     Fault fault = readMemAtomic(xc, addr, (uint8_t*)&mem,
                                 sizeof(MemT), flags, byte_enable);
     if (fault == NoFault) {
@@ -146,7 +146,7 @@ template <class XC>
 Fault
 writeMemTiming(XC *xc, uint8_t *mem, Addr addr,
                std::size_t size, Request::Flags flags, uint64_t *res,
-               const std::vector<bool> &byte_enable)
+               const ByteEnable &byte_enable)
 {
     return xc->writeMem(mem, size, addr, flags, res, byte_enable);
 }
@@ -160,7 +160,7 @@ writeMemTiming(XC *xc, Trace::InstRecord *traceData, MemT mem, Addr addr,
         traceData->setData(mem);
     }
     mem = htog(mem, Order);
-    static const std::vector<bool> byte_enable(sizeof(MemT), true);
+    static const ByteEnable byte_enable(sizeof(MemT), true);
     return writeMemTiming(xc, (uint8_t*)&mem, addr,
                           sizeof(MemT), flags, res, byte_enable);
 }
@@ -188,7 +188,7 @@ template <class XC>
 Fault
 writeMemAtomic(XC *xc, uint8_t *mem, Addr addr,
                std::size_t size, Request::Flags flags,
-               uint64_t *res, const std::vector<bool> &byte_enable)
+               uint64_t *res, const ByteEnable &byte_enable)
 {
     return xc->writeMem(mem, size, addr, flags, res, byte_enable);
 }
@@ -202,7 +202,7 @@ writeMemAtomic(XC *xc, Trace::InstRecord *traceData, const MemT &mem,
         traceData->setData(mem);
     }
     MemT host_mem = htog(mem, Order);
-    static const std::vector<bool> byte_enable(sizeof(MemT), true);
+    static const ByteEnable byte_enable(sizeof(MemT), true);
     Fault fault = writeMemAtomic(xc, (uint8_t*)&host_mem,
                                  addr, sizeof(MemT), flags, res, byte_enable);
     if (fault == NoFault && res != NULL) {
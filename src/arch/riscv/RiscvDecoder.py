@@ -23,9 +23,14 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+from m5.params import *
 from m5.objects.InstDecoder import InstDecoder
 
 class RiscvDecoder(InstDecoder):
     type = 'RiscvDecoder'
     cxx_class = 'gem5::RiscvISA::Decoder'
     cxx_header = "arch/riscv/decoder.hh"
+
+    coalesce_vec_seg = Param.Bool(True, "Execute unit-stride segment "
+        "loads/stores as one microop per register of a field group "
+        "instead of one microop per element and field")
@@ -113,6 +113,7 @@ Decoder::decode(PCStateBase &_next_pc)
     }
 
     emi.vtype8 = this->machVtype & 0xff;
+    emi.vsegCoalesce = coalesceVecSeg;
     StaticInstPtr inst = decode(emi, next_pc.instAddr());
     if (inst->isVectorConfig()) {
         auto vset = static_cast<VConfOp*>(inst.get());
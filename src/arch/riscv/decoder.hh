@@ -60,6 +60,10 @@ class Decoder : public InstDecoder
     bool vtypeReady = true;
     VTYPE machVtype;
 
+    /// Expand unit-stride segment accesses into one microop per register
+    /// of a field group instead of one per element and field.
+    const bool coalesceVecSeg;
+
     /// A cache of decoded instruction objects.
     static GenericISA::BasicDecodeCache<Decoder, ExtMachInst> defaultCache;
     friend class GenericISA::BasicDecodeCache<Decoder, ExtMachInst>;
@@ -72,7 +76,8 @@ class Decoder : public InstDecoder
     StaticInstPtr decode(ExtMachInst mach_inst, Addr addr);
 
   public:
-    Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst)
+    Decoder(const RiscvDecoderParams &p)
+        : InstDecoder(p, &machInst), coalesceVecSeg(p.coalesce_vec_seg)
     {
         reset();
     }
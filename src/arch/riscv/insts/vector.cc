@@ -28,12 +28,15 @@
 
 #include "arch/riscv/insts/vector.hh"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
 #include "arch/riscv/insts/static_inst.hh"
+#include "arch/riscv/regs/vector.hh"
 #include "arch/riscv/utility.hh"
 #include "cpu/static_inst.hh"
+#include "mem/packet.hh"
 
 namespace gem5
 {
@@ -191,6 +194,358 @@ std::string VleMicroInst::generateDisassembly(Addr pc,
     return ss.str();
 }
 
+namespace
+{
+
+/*
+ * Segment (de)interleave kernels. They are specialized on the element
+ * type and the field count so that the strides are compile time constants
+ * and the inner loops can be vectorized by the host compiler.
+ */
+template <typename T, unsigned NF>
+void
+deinterleaveFields(const uint8_t *mem, uint8_t *const *fields,
+                   uint32_t start, uint32_t num)
+{
+    const T *src = reinterpret_cast<const T *>(mem);
+    for (unsigned fn = 0; fn < NF; fn++) {
+        T *dst = reinterpret_cast<T *>(fields[fn]) + start;
+        for (uint32_t i = 0; i < num; i++)
+            dst[i] = src[i * NF + fn];
+    }
+}
+
+template <typename T, unsigned NF>
+void
+interleaveFields(const uint8_t *const *fields, uint8_t *mem,
+                 uint32_t start, uint32_t num)
+{
+    T *dst = reinterpret_cast<T *>(mem);
+    for (unsigned fn = 0; fn < NF; fn++) {
+        const T *src = reinterpret_cast<const T *>(fields[fn]) + start;
+        for (uint32_t i = 0; i < num; i++)
+            dst[i * NF + fn] = src[i];
+    }
+}
+
+template <typename T>
+void
+deinterleave(const uint8_t *mem, uint8_t *const *fields, uint32_t nf,
+             uint32_t start, uint32_t num)
+{
+    switch (nf) {
+      case 2: return deinterleaveFields<T, 2>(mem, fields, start, num);
+      case 3: return deinterleaveFields<T, 3>(mem, fields, start, num);
+      case 4: return deinterleaveFields<T, 4>(mem, fields, start, num);
+      case 5: return deinterleaveFields<T, 5>(mem, fields, start, num);
+      case 6: return deinterleaveFields<T, 6>(mem, fields, start, num);
+      case 7: return deinterleaveFields<T, 7>(mem, fields, start, num);
+      case 8: return deinterleaveFields<T, 8>(mem, fields, start, num);
+      default: panic("Invalid segment field count %d\n", nf);
+    }
+}
+
+template <typename T>
+void
+interleave(const uint8_t *const *fields, uint8_t *mem, uint32_t nf,
+           uint32_t start, uint32_t num)
+{
+    switch (nf) {
+      case 2: return interleaveFields<T, 2>(fields, mem, start, num);
+      case 3: return interleaveFields<T, 3>(fields, mem, start, num);
+      case 4: return interleaveFields<T, 4>(fields, mem, start, num);
+      case 5: return interleaveFields<T, 5>(fields, mem, start, num);
+      case 6: return interleaveFields<T, 6>(fields, mem, start, num);
+      case 7: return interleaveFields<T, 7>(fields, mem, start, num);
+      case 8: return interleaveFields<T, 8>(fields, mem, start, num);
+      default: panic("Invalid segment field count %d\n", nf);
+    }
+}
+
+void
+segDeinterleave(const uint8_t *mem, uint8_t *const *fields, uint32_t nf,
+                uint32_t eewb, uint32_t start, uint32_t num)
+{
+    switch (eewb) {
+      case 1: return deinterleave<uint8_t>(mem, fields, nf, start, num);
+      case 2: return deinterleave<uint16_t>(mem, fields, nf, start, num);
+      case 4: return deinterleave<uint32_t>(mem, fields, nf, start, num);
+      case 8: return deinterleave<uint64_t>(mem, fields, nf, start, num);
+      default: panic("Invalid segment element width %d\n", eewb);
+    }
+}
+
+void
+segInterleave(const uint8_t *const *fields, uint8_t *mem, uint32_t nf,
+              uint32_t eewb, uint32_t start, uint32_t num)
+{
+    switch (eewb) {
+      case 1: return interleave<uint8_t>(fields, mem, nf, start, num);
+      case 2: return interleave<uint16_t>(fields, mem, nf, start, num);
+      case 4: return interleave<uint32_t>(fields, mem, nf, start, num);
+      case 8: return interleave<uint64_t>(fields, mem, nf, start, num);
+      default: panic("Invalid segment element width %d\n", eewb);
+    }
+}
+
+/*
+ * Number of segments of [rs, re) that are below vl. Like the per-element
+ * microops, a masked access whose mask is all zero touches no memory.
+ */
+uint32_t
+segActiveElems(ExecContext *xc, const VectorMicroInst *inst, bool vm)
+{
+    const VectorMicroInfo &vmi = inst->vmi;
+    const uint32_t vl = xc->getRegOperand(inst, inst->vlsrcIdx);
+    const uint32_t end = std::min<uint32_t>(vl, vmi.re);
+    if (vmi.rs >= end)
+        return 0;
+    if (!vm) {
+        vreg_t tmp_v0;
+        xc->getRegOperand(inst, inst->vmsrcIdx, &tmp_v0);
+        if (popcount_in_byte(tmp_v0.as<uint64_t>(), vmi.rs, vmi.re) == 0)
+            return 0;
+    }
+    return end - vmi.rs;
+}
+
+} // anonymous namespace
+
+VlSegMicroInst::VlSegMicroInst(const char *mnem, ExtMachInst _machInst,
+        uint8_t _microIdx, const VectorMicroInfo &_vmi,
+        uint32_t field_stride)
+    : VectorMemMicroInst(mnem, _machInst, VectorSegUnitStrideLoadOp,
+                         _microIdx)
+{
+    setRegIdxArrays(
+        reinterpret_cast<RegIdArrayPtr>(
+            &std::remove_pointer_t<decltype(this)>::srcRegIdxArr),
+        reinterpret_cast<RegIdArrayPtr>(
+            &std::remove_pointer_t<decltype(this)>::destRegIdxArr));
+    vmi = _vmi;
+    assert(vmi.nf > 1 && vmi.nf <= 8);
+    _numSrcRegs = 0;
+    _numDestRegs = 0;
+    for (uint32_t fn = 0; fn < vmi.nf; fn++) {
+        setDestRegIdx(_numDestRegs++,
+                      RegId(VecRegClass, vmi.microVd + fn * field_stride));
+        _numTypedDestRegs[VecRegClass]++;
+    }
+    setSrcRegIdx(_numSrcRegs++, RegId(IntRegClass, _machInst.rs1));
+    vlsrcIdx = _numSrcRegs;
+    setSrcRegIdx(_numSrcRegs++, VecRenamedVLReg);
+    // The old vd of every field is kept for tail and inactive elements.
+    // oldDstIdx stays unset since the rename stage only knows how to
+    // eliminate a single old destination.
+    oldFieldIdx = _numSrcRegs;
+    for (uint32_t fn = 0; fn < vmi.nf; fn++) {
+        setSrcRegIdx(_numSrcRegs++, destRegIdx(fn));
+    }
+    if (!vm) {
+        vmsrcIdx = _numSrcRegs;
+        setSrcRegIdx(_numSrcRegs++, RegId(VecRegClass, 0));
+    }
+    flags[IsLoad] = true;
+}
+
+void
+VlSegMicroInst::writeFields(ExecContext *xc, const uint8_t *data,
+                            uint32_t num) const
+{
+    const uint32_t eewb = eew / 8;
+    const uint32_t start = vmi.rs % (VLEN / eew);
+
+    vreg_t fields[8];
+    uint8_t *field_ptrs[8];
+    for (uint32_t fn = 0; fn < vmi.nf; fn++) {
+        xc->getRegOperand(this, oldFieldIdx + fn, &fields[fn]);
+        field_ptrs[fn] = fields[fn].as<uint8_t>();
+    }
+
+    if (num > 0 && vm) {
+        segDeinterleave(data, field_ptrs, vmi.nf, eewb, start, num);
+    } else if (num > 0) {
+        vreg_t tmp_v0;
+        xc->getRegOperand(this, vmsrcIdx, &tmp_v0);
+        const uint8_t *v0 = tmp_v0.as<uint8_t>();
+
+        vreg_t scratch[8];
+        uint8_t *scratch_ptrs[8];
+        for (uint32_t fn = 0; fn < vmi.nf; fn++)
+            scratch_ptrs[fn] = scratch[fn].as<uint8_t>();
+        segDeinterleave(data, scratch_ptrs, vmi.nf, eewb, start, num);
+
+        for (uint32_t i = 0; i < num; i++) {
+            if (!elem_mask(v0, vmi.rs + i))
+                continue;
+            const uint32_t off = (start + i) * eewb;
+            for (uint32_t fn = 0; fn < vmi.nf; fn++)
+                memcpy(field_ptrs[fn] + off, scratch_ptrs[fn] + off, eewb);
+        }
+    }
+
+    for (uint32_t fn = 0; fn < vmi.nf; fn++)
+        xc->setRegOperand(this, fn, &fields[fn]);
+}
+
+Fault
+VlSegMicroInst::execute(ExecContext *xc, Trace::InstRecord *traceData) const
+{
+    const Addr EA = xc->getRegOperand(this, 0) + vmi.offset;
+    const uint32_t num = segActiveElems(xc, this, vm);
+    const uint32_t mem_size = num * vmi.nf * eew / 8;
+
+    alignas(8) uint8_t data[8 * VLENB];
+    if (mem_size > 0) {
+        ByteEnable byte_enable(mem_size, true);
+        Fault fault = xc->readMem(EA, data, mem_size, memAccessFlags,
+                                  byte_enable);
+        if (fault != NoFault)
+            return fault;
+    }
+
+    writeFields(xc, data, num);
+    return NoFault;
+}
+
+Fault
+VlSegMicroInst::initiateAcc(ExecContext *xc,
+                            Trace::InstRecord *traceData) const
+{
+    const Addr EA = xc->getRegOperand(this, 0) + vmi.offset;
+    const uint32_t mem_size = segActiveElems(xc, this, vm) * vmi.nf * eew / 8;
+
+    ByteEnable byte_enable(mem_size, true);
+    return xc->initiateMemRead(EA, mem_size, memAccessFlags, byte_enable);
+}
+
+Fault
+VlSegMicroInst::completeAcc(PacketPtr pkt, ExecContext *xc,
+                            Trace::InstRecord *traceData) const
+{
+    const uint32_t num = segActiveElems(xc, this, vm);
+    if (pkt) {
+        assert(pkt->getSize() == num * vmi.nf * eew / 8);
+        writeFields(xc, pkt->getConstPtr<uint8_t>(), num);
+    } else {
+        assert(num == 0);
+        writeFields(xc, nullptr, 0);
+    }
+    return NoFault;
+}
+
+std::string
+VlSegMicroInst::generateDisassembly(Addr pc,
+        const loader::SymbolTable *symtab) const
+{
+    std::stringstream ss;
+    ss << mnemonic << ' ';
+    for (uint32_t fn = 0; fn < vmi.nf; fn++)
+        ss << registerName(destRegIdx(fn)) << ", ";
+    ss << vmi.offset << '(' << registerName(srcRegIdx(0)) << ')';
+    if (!machInst.vm) ss << ", v0.t";
+    return ss.str();
+}
+
+VsSegMicroInst::VsSegMicroInst(const char *mnem, ExtMachInst _machInst,
+        uint8_t _microIdx, const VectorMicroInfo &_vmi,
+        uint32_t field_stride)
+    : VectorMemMicroInst(mnem, _machInst, VectorSegUnitStrideStoreOp,
+                         _microIdx)
+{
+    setRegIdxArrays(
+        reinterpret_cast<RegIdArrayPtr>(
+            &std::remove_pointer_t<decltype(this)>::srcRegIdxArr),
+        reinterpret_cast<RegIdArrayPtr>(
+            &std::remove_pointer_t<decltype(this)>::destRegIdxArr));
+    vmi = _vmi;
+    assert(vmi.nf > 1 && vmi.nf <= 8);
+    _numSrcRegs = 0;
+    _numDestRegs = 0;
+    setSrcRegIdx(_numSrcRegs++, RegId(IntRegClass, _machInst.rs1));
+    for (uint32_t fn = 0; fn < vmi.nf; fn++) {
+        setSrcRegIdx(_numSrcRegs++,
+                     RegId(VecRegClass, vmi.microVs3 + fn * field_stride));
+    }
+    vlsrcIdx = _numSrcRegs;
+    setSrcRegIdx(_numSrcRegs++, VecRenamedVLReg);
+    if (!vm) {
+        vmsrcIdx = _numSrcRegs;
+        setSrcRegIdx(_numSrcRegs++, RegId(VecRegClass, 0));
+    }
+    flags[IsStore] = true;
+}
+
+Fault
+VsSegMicroInst::storeFields(ExecContext *xc) const
+{
+    const Addr EA = xc->getRegOperand(this, 0) + vmi.offset;
+    const uint32_t num = segActiveElems(xc, this, vm);
+    const uint32_t eewb = eew / 8;
+    const uint32_t seg_size = vmi.nf * eewb;
+    const uint32_t mem_size = num * seg_size;
+    if (mem_size == 0)
+        return NoFault;
+
+    vreg_t fields[8];
+    const uint8_t *field_ptrs[8];
+    for (uint32_t fn = 0; fn < vmi.nf; fn++) {
+        xc->getRegOperand(this, 1 + fn, &fields[fn]);
+        field_ptrs[fn] = fields[fn].as<uint8_t>();
+    }
+
+    alignas(8) uint8_t data[8 * VLENB];
+    segInterleave(field_ptrs, data, vmi.nf, eewb, vmi.rs % (VLEN / eew), num);
+
+    ByteEnable byte_enable(mem_size, true);
+    if (!vm) {
+        vreg_t tmp_v0;
+        xc->getRegOperand(this, vmsrcIdx, &tmp_v0);
+        const uint8_t *v0 = tmp_v0.as<uint8_t>();
+        for (uint32_t i = 0; i < num; i++) {
+            if (!elem_mask(v0, vmi.rs + i)) {
+                byte_enable.set(i * seg_size, seg_size, false);
+            }
+        }
+    }
+
+    return xc->writeMem(data, mem_size, EA, memAccessFlags, nullptr,
+                        byte_enable);
+}
+
+Fault
+VsSegMicroInst::execute(ExecContext *xc, Trace::InstRecord *traceData) const
+{
+    return storeFields(xc);
+}
+
+Fault
+VsSegMicroInst::initiateAcc(ExecContext *xc,
+                            Trace::InstRecord *traceData) const
+{
+    return storeFields(xc);
+}
+
+Fault
+VsSegMicroInst::completeAcc(PacketPtr pkt, ExecContext *xc,
+                            Trace::InstRecord *traceData) const
+{
+    return NoFault;
+}
+
+std::string
+VsSegMicroInst::generateDisassembly(Addr pc,
+        const loader::SymbolTable *symtab) const
+{
+    std::stringstream ss;
+    ss << mnemonic << ' ';
+    for (uint32_t fn = 0; fn < vmi.nf; fn++)
+        ss << registerName(srcRegIdx(1 + fn)) << ", ";
+    ss << vmi.offset << '(' << registerName(srcRegIdx(0)) << ')';
+    if (!machInst.vm) ss << ", v0.t";
+    return ss.str();
+}
+
 std::string VleffMicroInst::generateDisassembly(Addr pc,
         const loader::SymbolTable *symtab) const
 {
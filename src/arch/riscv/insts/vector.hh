@@ -335,6 +335,65 @@ class VseMicroInst : public VectorMemMicroInst
         Addr pc, const loader::SymbolTable *symtab) const override;
 };
 
+/**
+ * Coalesced unit-stride segment load. One microop loads the nf * VLENB
+ * contiguous bytes holding segments [rs, re) and de-interleaves them into
+ * one register of every field group (vd + fn * fieldStride + microIdx).
+ */
+class VlSegMicroInst : public VectorMemMicroInst
+{
+  private:
+    // rs1, vl, old vd of every field, v0
+    RegId srcRegIdxArr[11];
+    RegId destRegIdxArr[8];
+    // index of the old vd of field 0, the other fields follow
+    int oldFieldIdx = -1;
+
+    void writeFields(ExecContext *xc, const uint8_t *data,
+                     uint32_t num) const;
+
+  public:
+    VlSegMicroInst(const char *mnem, ExtMachInst _machInst,
+                   uint8_t _microIdx, const VectorMicroInfo &_vmi,
+                   uint32_t field_stride);
+
+    Fault execute(ExecContext *, Trace::InstRecord *) const override;
+    Fault initiateAcc(ExecContext *, Trace::InstRecord *) const override;
+    Fault completeAcc(PacketPtr, ExecContext *,
+                      Trace::InstRecord *) const override;
+
+    std::string generateDisassembly(
+        Addr pc, const loader::SymbolTable *symtab) const override;
+};
+
+/**
+ * Coalesced unit-stride segment store, the counterpart of VlSegMicroInst.
+ * One register of every field group is interleaved into a single
+ * nf * VLENB store, inactive elements are left out of the byte enable.
+ */
+class VsSegMicroInst : public VectorMemMicroInst
+{
+  private:
+    // rs1, vs3 of every field, vl, v0
+    RegId srcRegIdxArr[11];
+    RegId destRegIdxArr[0];
+
+    Fault storeFields(ExecContext *xc) const;
+
+  public:
+    VsSegMicroInst(const char *mnem, ExtMachInst _machInst,
+                   uint8_t _microIdx, const VectorMicroInfo &_vmi,
+                   uint32_t field_stride);
+
+    Fault execute(ExecContext *, Trace::InstRecord *) const override;
+    Fault initiateAcc(ExecContext *, Trace::InstRecord *) const override;
+    Fault completeAcc(PacketPtr, ExecContext *,
+                      Trace::InstRecord *) const override;
+
+    std::string generateDisassembly(
+        Addr pc, const loader::SymbolTable *symtab) const override;
+};
+
 class VleffMicroInst : public VectorMemMicroInst
 {
   protected:
@@ -87,6 +87,11 @@ class MMU : public BaseMMU
       BaseMMU::takeOverFrom(ommu);
       pma->takeOverFrom(ommu->pma);
 
+      // itb and dtb share the L2 TLB, which BaseMMU does not reach
+      BaseTLB *l2_tlb = dtb->nextLevel();
+      if (l2_tlb && ommu->dtb->nextLevel())
+          l2_tlb->takeOverFrom(ommu->dtb->nextLevel());
+
     }
 
     PMP *
@@ -31,6 +31,7 @@
 
 #include "arch/riscv/tlb.hh"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -970,6 +971,55 @@ TLB::flushAll()
     }
 }
 
+void
+TLB::takeOverFrom(BaseTLB *old)
+{
+    TLB *otlb = dynamic_cast<TLB *>(old);
+    assert(otlb);
+
+    if (is_L1tlb) {
+        takeOverEntries(otlb->tlb, tlb, trie, freeList);
+    }
+    if (isStage2 || isTheSharedL2) {
+        takeOverEntries(otlb->tlbL2L1, tlbL2L1, trieL2L1, freeListL2L1);
+        takeOverEntries(otlb->tlbL2L2, tlbL2L2, trieL2L2, freeListL2L2);
+        takeOverEntries(otlb->tlbL2L3, tlbL2L3, trieL2L3, freeListL2L3);
+        takeOverEntries(otlb->tlbL2Sp, tlbL2Sp, trieL2sp, freeListL2sp);
+    }
+    lruSeq = std::max(lruSeq, otlb->lruSeq);
+}
+
+void
+TLB::takeOverEntries(const std::vector<TlbEntry> &from,
+                     std::vector<TlbEntry> &to, TlbEntryTrie &to_trie,
+                     EntryList &to_free)
+{
+    // L2 entries are evicted a line at a time, so positions must match
+    if (from.size() != to.size()) {
+        warn("%s: cannot take over %d TLB entries into %d, "
+             "starting cold.\n", name(), from.size(), to.size());
+        return;
+    }
+
+    for (auto &entry : to) {
+        if (entry.trieHandle)
+            to_trie.remove(entry.trieHandle);
+    }
+    to_free.clear();
+
+    for (size_t i = 0; i < to.size(); i++) {
+        to[i] = from[i];
+        if (from[i].trieHandle) {
+            // entries do not keep their translate mode, reuse the old key
+            to[i].trieHandle = to_trie.insert(from[i].trieHandle->key,
+                TlbEntryTrie::MaxBits - to[i].logBytes, &to[i]);
+        } else {
+            to[i].trieHandle = nullptr;
+            to_free.push_back(&to[i]);
+        }
+    }
+}
+
 void
 TLB::remove(size_t idx)
 {
@@ -178,7 +178,11 @@ class TLB : public BaseTLB
 
     Walker *getWalker();
 
-    void takeOverFrom(BaseTLB *old) override {}
+    /**
+     * Copy the entries of a switched out TLB of the same geometry, so a
+     * CPU switched in after a functional warmup starts with its TLBs warm.
+     */
+    void takeOverFrom(BaseTLB *old) override;
 
     TlbEntry *insert(Addr vpn, const TlbEntry &entry, bool suqashed_update, uint8_t translateMode);
     TlbEntry *insertForwardPre(Addr vpn, const TlbEntry &entry);
@@ -290,6 +294,9 @@ class TLB : public BaseTLB
     void l2TLBEvictLRU(int l2TLBlevel, Addr vaddr);
 
     void remove(size_t idx);
+    void takeOverEntries(const std::vector<TlbEntry> &from,
+                         std::vector<TlbEntry> &to, TlbEntryTrie &to_trie,
+                         EntryList &to_free);
     void removeForwardPre(size_t idx);
     void removeBackPre(size_t idx);
     void l2tlbRemoveIn(EntryList *List, TlbEntryTrie *Trie_l2,std::vector<TlbEntry>&tlb,size_t idx, int choose);
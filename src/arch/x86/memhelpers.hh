@@ -48,7 +48,7 @@ static Fault
 initiateMemRead(ExecContext *xc, Trace::InstRecord *traceData, Addr addr,
                 unsigned dataSize, Request::Flags flags)
 {
-    const std::vector<bool> byte_enable(dataSize, true);
+    const ByteEnable byte_enable(dataSize, true);
     return xc->initiateMemRead(addr, dataSize, flags, byte_enable);
 }
 
@@ -110,7 +110,7 @@ readMemAtomic(ExecContext *xc, Trace::InstRecord *traceData, Addr addr,
               uint64_t &mem, unsigned dataSize, Request::Flags flags)
 {
     memset(&mem, 0, sizeof(mem));
-    const std::vector<bool> byte_enable(dataSize, true);
+    const ByteEnable byte_enable(dataSize, true);
     Fault fault = xc->readMem(addr, (uint8_t *)&mem, dataSize,
                               flags, byte_enable);
     if (fault == NoFault) {
@@ -132,7 +132,7 @@ readPackedMemAtomic(ExecContext *xc, Addr addr, std::array<uint64_t, N> &mem,
     std::array<T, N> real_mem;
     // Size is fixed at compilation time. Make a static vector.
     constexpr auto size = sizeof(T) * N;
-    static const std::vector<bool> byte_enable(size, true);
+    static const ByteEnable byte_enable(size, true);
     Fault fault = xc->readMem(addr, (uint8_t *)&real_mem,
                               size, flags, byte_enable);
     if (fault == NoFault) {
@@ -177,7 +177,7 @@ writePackedMem(ExecContext *xc, std::array<uint64_t, N> &mem, Addr addr,
     real_mem = htole(real_mem);
     // Size is fixed at compilation time. Make a static vector.
     constexpr auto size = sizeof(T) * N;
-    static const std::vector<bool> byte_enable(size, true);
+    static const ByteEnable byte_enable(size, true);
     return xc->writeMem((uint8_t *)&real_mem, size,
                         addr, flags, res, byte_enable);
 }
@@ -190,7 +190,7 @@ writeMemTiming(ExecContext *xc, Trace::InstRecord *traceData, uint64_t mem,
     if (traceData)
         traceData->setData(mem);
     mem = htole(mem);
-    const std::vector<bool> byte_enable(dataSize, true);
+    const ByteEnable byte_enable(dataSize, true);
     return xc->writeMem((uint8_t *)&mem, dataSize, addr, flags,
                         res, byte_enable);
 }
@@ -222,7 +222,7 @@ writeMemAtomic(ExecContext *xc, Trace::InstRecord *traceData, uint64_t mem,
     if (traceData)
         traceData->setData(mem);
     uint64_t host_mem = htole(mem);
-    const std::vector<bool> byte_enable(dataSize, true);
+    const ByteEnable byte_enable(dataSize, true);
     Fault fault = xc->writeMem((uint8_t *)&host_mem, dataSize, addr,
                                flags, res, byte_enable);
     if (fault == NoFault && res)
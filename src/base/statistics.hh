@@ -79,6 +79,7 @@
 #include "base/cprintf.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
+#include "base/stats/counter_bank.hh"
 #include "base/stats/group.hh"
 #include "base/stats/info.hh"
 #include "base/stats/output.hh"
@@ -2054,6 +2055,143 @@ class AverageVector : public VectorBase<AverageVector, AvgStor>
     }
 };
 
+/**
+ * A counter that keeps its value in the CounterBank of its group, next
+ * to the other banked counters of the group. It is used like a Scalar
+ * for the hot counters of an object, but only counts whole numbers.
+ * @sa CounterBank, Scalar
+ */
+class BankedScalar : public DataWrap<BankedScalar, ScalarInfoProxy>
+{
+  private:
+    CounterBank::Count *count;
+
+  public:
+    BankedScalar(Group *parent, const char *name,
+                 const char *desc = nullptr)
+        : BankedScalar(parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    BankedScalar(Group *parent, const char *name, const units::Base *unit,
+                 const char *desc = nullptr)
+        : DataWrap<BankedScalar, ScalarInfoProxy>(parent, name, unit, desc)
+    {
+        panic_if(!parent, "Banked counter %s needs a group.", name);
+        count = parent->counterBank().allocate(1);
+        this->setInit();
+    }
+
+    void operator++() { ++*count; }
+    void operator--() { --*count; }
+    void operator++(int) { ++*count; }
+    void operator--(int) { --*count; }
+
+    template <typename U>
+    void operator=(const U &v) { *count = v; }
+    template <typename U>
+    void operator+=(const U &v) { *count += v; }
+    template <typename U>
+    void operator-=(const U &v) { *count -= v; }
+
+    size_type size() const { return 1; }
+    Counter value() const { return *count; }
+    Result result() const { return *count; }
+    Result total() const { return *count; }
+
+    bool zero() const { return *count == 0; }
+    void reset() { *count = 0; }
+    void prepare() { }
+};
+
+/**
+ * A vector of banked counters. The elements are consecutive slots of the
+ * CounterBank of the group and are accessed as plain counts.
+ * @sa CounterBank, Vector
+ */
+class BankedVector : public DataWrapVec<BankedVector, VectorInfoProxy>
+{
+  private:
+    CounterBank *bank;
+    CounterBank::Count *counts = nullptr;
+    size_type _size = 0;
+
+  public:
+    BankedVector(Group *parent, const char *name,
+                 const char *desc = nullptr)
+        : BankedVector(parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    BankedVector(Group *parent, const char *name, const units::Base *unit,
+                 const char *desc = nullptr)
+        : DataWrapVec<BankedVector, VectorInfoProxy>(parent, name, unit, desc)
+    {
+        panic_if(!parent, "Banked counter %s needs a group.", name);
+        bank = &parent->counterBank();
+    }
+
+    /**
+     * Set this vector to have the given size.
+     * @param size The new size.
+     * @return A reference to this stat.
+     */
+    BankedVector &
+    init(size_type size)
+    {
+        fatal_if(size <= 0, "Storage size must be positive");
+        fatal_if(check(), "Stat has already been initialized");
+
+        counts = bank->allocate(size);
+        _size = size;
+        this->setInit();
+        return *this;
+    }
+
+    CounterBank::Count &
+    operator[](off_type index)
+    {
+        panic_if(!(index < size()), this->name());
+        return counts[index];
+    }
+
+    size_type size() const { return _size; }
+
+    void
+    value(VCounter &vec) const
+    {
+        vec.assign(counts, counts + _size);
+    }
+
+    void
+    result(VResult &vec) const
+    {
+        vec.assign(counts, counts + _size);
+    }
+
+    Result
+    total() const
+    {
+        Result total = 0.0;
+        for (off_type i = 0; i < _size; ++i)
+            total += counts[i];
+        return total;
+    }
+
+    bool
+    zero() const
+    {
+        for (off_type i = 0; i < _size; ++i)
+            if (counts[i] != 0)
+                return false;
+        return true;
+    }
+
+    bool check() const { return _size > 0; }
+    void reset() { std::fill(counts, counts + _size, 0); }
+    void prepare() { }
+};
+
 /**
  * A 2-Dimensional vecto of scalar stats.
  * @sa Stat, Vector2dBase, StatStor
@@ -2703,6 +2841,14 @@ class Temp
         : node(new ScalarStatNode(s.info()))
     { }
 
+    /**
+     * Create a new ScalarStatNode.
+     * @param s The BankedScalar to place in a node.
+     */
+    Temp(const BankedScalar &s)
+        : node(new ScalarStatNode(s.info()))
+    { }
+
     /**
      * Create a new VectorStatNode.
      * @param s The VectorStat to place in a node.
@@ -2715,6 +2861,14 @@ class Temp
         : node(new VectorStatNode(s.info()))
     { }
 
+    /**
+     * Create a new VectorStatNode.
+     * @param s The BankedVector to place in a node.
+     */
+    Temp(const BankedVector &s)
+        : node(new VectorStatNode(s.info()))
+    { }
+
     /**
      *
      */
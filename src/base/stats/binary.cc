@@ -0,0 +1,388 @@
+#include "base/stats/binary.hh"
+
+#include <zlib.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+const char magic[] = "gem5sbin";
+
+void
+putVarint(std::string &out, uint64_t v)
+{
+    while (v >= 0x80) {
+        out.push_back(char(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(char(v));
+}
+
+void
+putString(std::string &out, const std::string &s)
+{
+    putVarint(out, s.size());
+    out.append(s);
+}
+
+/** Whether v can be delta encoded as an integer without loss. */
+bool
+integral(double v)
+{
+    return std::fabs(v) < 0x1p53 && v == std::trunc(v);
+}
+
+std::string
+indexName(const std::vector<std::string> &subnames, size_t i)
+{
+    return i < subnames.size() && !subnames[i].empty() ? subnames[i] :
+        std::to_string(i);
+}
+
+} // anonymous namespace
+
+Binary::Binary(const std::string &file)
+    : fname(file), stream(simout.create(file, true))
+{
+    std::ostream &os = *stream->stream();
+    os.write(magic, sizeof(magic) - 1);
+    os.flush();
+}
+
+Binary::~Binary()
+{
+    simout.close(stream);
+}
+
+bool
+Binary::valid() const
+{
+    return stream && stream->stream()->good();
+}
+
+void
+Binary::begin()
+{
+    statCount = 0;
+    values.clear();
+}
+
+void
+Binary::end()
+{
+    if (statCount != schema.size()) {
+        schema.resize(statCount);
+        schemaChanged = true;
+    }
+
+    if (schemaChanged) {
+        writeSchema();
+        lastValues.assign(values.size(), 0.0);
+        schemaChanged = false;
+    }
+
+    writeDump();
+    lastValues.swap(values);
+}
+
+std::string
+Binary::statName(const std::string &name) const
+{
+    return path.empty() ? name : path.top() + "." + name;
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    path.push(path.empty() ? std::string(name) : path.top() + "." + name);
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+template <typename Columns>
+void
+Binary::addStat(const Info &info, const std::vector<double> &vals,
+                Columns columns, bool check_names)
+{
+    bool same = statCount < schema.size() &&
+        schema[statCount].info == &info &&
+        schema[statCount].names.size() == vals.size();
+    if (same && check_names) {
+        std::vector<std::string> names;
+        columns(names);
+        same = names == schema[statCount].names;
+    }
+
+    if (!same) {
+        // everything from here on is laid out again as it is visited
+        schema.resize(statCount);
+        schema.push_back({&info, {}});
+        columns(schema.back().names);
+        assert(schema.back().names.size() == vals.size());
+        schemaChanged = true;
+    }
+
+    statCount++;
+    values.insert(values.end(), vals.begin(), vals.end());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    statValues.assign(1, info.result());
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        names.push_back(statName(info.name));
+    });
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &result = info.result();
+    statValues.assign(result.begin(), result.end());
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        const std::string name = statName(info.name);
+        if (result.size() == 1 && indexName(info.subnames, 0) == "0") {
+            names.push_back(name);
+            return;
+        }
+        for (size_t i = 0; i < result.size(); i++) {
+            names.push_back(name + info.separatorString +
+                            indexName(info.subnames, i));
+        }
+    });
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    statValues.assign(info.cvec.begin(), info.cvec.end());
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        for (size_t i = 0; i < info.x; i++) {
+            const std::string base = statName(
+                info.name + "_" + indexName(info.subnames, i)) +
+                info.separatorString;
+            for (size_t j = 0; j < info.y; j++)
+                names.push_back(base + indexName(info.y_subnames, j));
+        }
+    });
+}
+
+void
+Binary::distColumns(const std::string &base, const DistData &data,
+                    std::vector<std::string> &columns)
+{
+    columns.push_back(base + "samples");
+    columns.push_back(base + "sum");
+    columns.push_back(base + "squares");
+    if (data.type == Hist)
+        columns.push_back(base + "logs");
+    if (data.type == Deviation)
+        return;
+
+    if (data.type == Dist) {
+        columns.push_back(base + "underflows");
+        columns.push_back(base + "overflows");
+        columns.push_back(base + "min_value");
+        columns.push_back(base + "max_value");
+    }
+    for (size_t i = 0; i < data.cvec.size(); i++) {
+        Counter low = i * data.bucket_size + data.min;
+        Counter high = std::min(low + data.bucket_size - 1.0, data.max);
+        columns.push_back(base + (low < high ?
+                                  csprintf("%s-%s", low, high) :
+                                  csprintf("%s", low)));
+    }
+}
+
+void
+Binary::distValues(const DistData &data, std::vector<double> &vals)
+{
+    vals.push_back(data.samples);
+    vals.push_back(data.sum);
+    vals.push_back(data.squares);
+    if (data.type == Hist)
+        vals.push_back(data.logs);
+    if (data.type == Deviation)
+        return;
+
+    if (data.type == Dist) {
+        vals.push_back(data.underflow);
+        vals.push_back(data.overflow);
+        vals.push_back(data.min_val);
+        vals.push_back(data.max_val);
+    }
+    vals.insert(vals.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    statValues.clear();
+    distValues(info.data, statValues);
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        distColumns(statName(info.name) + info.separatorString, info.data,
+                    names);
+    });
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    statValues.clear();
+    for (const auto &data : info.data)
+        distValues(data, statValues);
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        for (size_t i = 0; i < info.data.size(); i++) {
+            distColumns(statName(info.name + "_" +
+                                 indexName(info.subnames, i)) +
+                        info.separatorString, info.data[i], names);
+        }
+    });
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    statValues.assign(1, info.data.samples);
+    for (const auto &[key, count] : info.data.cmap)
+        statValues.push_back(count);
+    // the buckets come and go with the samples
+    addStat(info, statValues, [&](std::vector<std::string> &names)
+    {
+        const std::string base = statName(info.name) + info.separatorString;
+        names.push_back(base + "samples");
+        for (const auto &[key, count] : info.data.cmap)
+            names.push_back(base + csprintf("%s", key));
+    }, true);
+}
+
+void
+Binary::writeRecord(char tag, const std::string &payload)
+{
+    uLongf packed_size = compressBound(payload.size());
+    std::vector<Bytef> packed(packed_size);
+    int ret = compress2(packed.data(), &packed_size,
+                        (const Bytef *)payload.data(), payload.size(),
+                        Z_BEST_SPEED);
+    panic_if(ret != Z_OK, "Failed to compress stats for %s: %d\n",
+             fname, ret);
+
+    std::string header(1, tag);
+    putVarint(header, payload.size());
+    putVarint(header, packed_size);
+
+    std::ostream &os = *stream->stream();
+    os.write(header.data(), header.size());
+    os.write((const char *)packed.data(), packed_size);
+    os.flush();
+}
+
+void
+Binary::writeSchema()
+{
+    std::string payload;
+    size_t columns = 0;
+    for (const auto &stat : schema)
+        columns += stat.names.size();
+
+    putVarint(payload, columns);
+    for (const auto &stat : schema) {
+        for (const auto &name : stat.names)
+            putString(payload, name);
+    }
+    writeRecord('S', payload);
+}
+
+void
+Binary::writeDump()
+{
+    assert(values.size() == lastValues.size());
+
+    std::string changes;
+    size_t changed = 0;
+    size_t next = 0;
+    for (size_t i = 0; i < values.size(); i++) {
+        const double v = values[i];
+        const double last = lastValues[i];
+        if (std::memcmp(&v, &last, sizeof(v)) == 0)
+            continue;
+
+        const bool raw = !integral(v) || !integral(last);
+        putVarint(changes, (uint64_t(i - next) << 1) | raw);
+        if (raw) {
+            uint64_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            for (int b = 0; b < 8; b++)
+                changes.push_back(char(bits >> (8 * b)));
+        } else {
+            int64_t delta = int64_t(v) - int64_t(last);
+            putVarint(changes, (uint64_t(delta) << 1) ^
+                      uint64_t(delta >> 63));
+        }
+        changed++;
+        next = i + 1;
+    }
+
+    std::string payload;
+    putVarint(payload, curTick());
+    putVarint(payload, changed);
+    payload.append(changes);
+    writeRecord('D', payload);
+}
+
+std::unique_ptr<Output>
+initBinary(const std::string &filename)
+{
+    return std::unique_ptr<Output>(new Binary(filename));
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * Binary statistics output for frequent periodic dumps. The names of
+ * the values are written once, and each dump only carries the values
+ * that changed since the previous dump, delta encoded and compressed.
+ * util/binary_stats.py reads the stream back.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Info;
+
+/**
+ * The stream starts with the 8 byte magic "gem5sbin" and is followed by
+ * records, each a tag byte, the varint sizes of its payload before and
+ * after compression and the zlib compressed payload:
+ *
+ * - 'S' (schema): the varint number of columns, then the name of each
+ *   column as a varint length and the bytes. Written before the first
+ *   dump and again whenever the stats being dumped change, after which
+ *   the previous values of all columns count as zero.
+ * - 'D' (dump): the varint tick and the varint number of changed
+ *   columns, then per changed column a varint holding the number of
+ *   columns skipped since the last changed one shifted left by one,
+ *   with the low bit set if the value follows as a raw little-endian
+ *   double. Otherwise a zigzag varint holding the integral difference
+ *   to the previous value follows.
+ *
+ * Every record is flushed as it is written, so the stream can be read
+ * while the simulation still runs, or after it was killed.
+ */
+class Binary : public Output
+{
+  public:
+    Binary(const std::string &file);
+    ~Binary();
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** Full name of a stat in the current group. */
+    std::string statName(const std::string &name) const;
+
+    /**
+     * Append the values of a stat to this dump, checking its columns
+     * against the schema.
+     *
+     * @param info The stat.
+     * @param columns Makes the names of the columns, only called when
+     * the schema has to be rebuilt.
+     * @param check_names Compare the names of the columns too and not
+     * only their number, for stats whose columns change on their own.
+     */
+    template <typename Columns>
+    void addStat(const Info &info, const std::vector<double> &vals,
+                 Columns columns, bool check_names=false);
+
+    /** Names and values of the columns of one distribution. */
+    static void distColumns(const std::string &base, const DistData &data,
+                            std::vector<std::string> &columns);
+    static void distValues(const DistData &data, std::vector<double> &vals);
+
+    void writeRecord(char tag, const std::string &payload);
+    void writeSchema();
+    void writeDump();
+
+  protected:
+    const std::string fname;
+    OutputStream *stream;
+
+    std::stack<std::string> path;
+
+    /** The columns of a stat in the order of the last dump. */
+    struct StatColumns
+    {
+        const Info *info;
+        std::vector<std::string> names;
+    };
+    std::vector<StatColumns> schema;
+
+    /** Number of stats visited in the current dump. */
+    size_t statCount = 0;
+    bool schemaChanged = false;
+
+    std::vector<double> values;
+    std::vector<double> lastValues;
+
+    /** Scratch space for the values of one stat. */
+    std::vector<double> statValues;
+};
+
+std::unique_ptr<Output> initBinary(const std::string &filename);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
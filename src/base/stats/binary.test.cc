@@ -0,0 +1,317 @@
+/**
+ * @file
+ * Round trips of the binary stats output through a decoder of the
+ * format described in binary.hh.
+ */
+
+#include <gtest/gtest.h>
+
+#include <zlib.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/output.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/info.hh"
+
+using namespace gem5;
+
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+class TestScalar : public statistics::ScalarInfo
+{
+  public:
+    double val = 0;
+
+    TestScalar(const std::string &name)
+    {
+        setName(name, false);
+        flags.set(statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { val = 0; }
+    bool zero() const override { return val == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+/** The values of one dump as read back, with how each change was coded. */
+struct Dump
+{
+    Tick tick;
+    bool newSchema;
+    std::vector<std::string> names;
+    std::vector<double> values;
+    std::vector<size_t> deltaColumns;
+    std::vector<size_t> rawColumns;
+};
+
+class Reader
+{
+  public:
+    Reader(const std::string &data) : data(data) {}
+
+    std::vector<Dump>
+    dumps()
+    {
+        std::vector<Dump> dumps;
+        EXPECT_EQ(data.compare(0, 8, "gem5sbin"), 0);
+        pos = 8;
+
+        std::vector<std::string> names;
+        std::vector<double> values;
+        bool new_schema = false;
+        while (pos < data.size()) {
+            const char tag = data[pos++];
+            const uint64_t raw_size = varint();
+            const uint64_t packed_size = varint();
+            std::string payload(raw_size, '\0');
+            uLongf size = raw_size;
+            EXPECT_EQ(uncompress((Bytef *)payload.data(), &size,
+                                 (const Bytef *)data.data() + pos,
+                                 packed_size), Z_OK);
+            EXPECT_EQ(size, raw_size);
+            pos += packed_size;
+
+            Reader rec(payload);
+            if (tag == 'S') {
+                names.resize(rec.varint());
+                for (auto &name : names)
+                    name = rec.bytes(rec.varint());
+                values.assign(names.size(), 0);
+                new_schema = true;
+                continue;
+            }
+
+            EXPECT_EQ(tag, 'D');
+            Dump dump{rec.varint(), new_schema, names};
+            size_t col = 0;
+            for (uint64_t changes = rec.varint(); changes; changes--) {
+                const uint64_t head = rec.varint();
+                col += head >> 1;
+                if (head & 1) {
+                    uint64_t bits = 0;
+                    const std::string raw = rec.bytes(8);
+                    for (int b = 0; b < 8; b++)
+                        bits |= uint64_t(uint8_t(raw[b])) << (8 * b);
+                    std::memcpy(&values[col], &bits, sizeof(bits));
+                    dump.rawColumns.push_back(col);
+                } else {
+                    const uint64_t zz = rec.varint();
+                    const int64_t delta =
+                        int64_t(zz >> 1) ^ -int64_t(zz & 1);
+                    values[col] = int64_t(values[col]) + delta;
+                    dump.deltaColumns.push_back(col);
+                }
+                col++;
+            }
+            dump.values = values;
+            dumps.push_back(dump);
+            new_schema = false;
+        }
+        return dumps;
+    }
+
+  private:
+    uint64_t
+    varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; ; shift += 7) {
+            const uint8_t byte = data.at(pos++);
+            value |= uint64_t(byte & 0x7f) << shift;
+            if (byte < 0x80)
+                return value;
+        }
+    }
+
+    std::string
+    bytes(size_t size)
+    {
+        std::string chunk = data.substr(pos, size);
+        pos += size;
+        return chunk;
+    }
+
+    const std::string data;
+    size_t pos = 0;
+};
+
+class StatsBinaryTest : public testing::Test
+{
+  protected:
+    void
+    SetUp() override
+    {
+        char dir[] = "/tmp/binary_stats_testXXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dirName = dir;
+        simout.setDirectory(dirName);
+        tickHandler.setCurTick(0);
+    }
+
+    void
+    TearDown() override
+    {
+        std::remove((dirName + "/stats.bin").c_str());
+        std::remove(dirName.c_str());
+    }
+
+    /** Dump the stats at the given tick. */
+    void
+    dump(statistics::Output &out, Tick tick,
+         const std::vector<TestScalar *> &stats)
+    {
+        tickHandler.setCurTick(tick);
+        out.begin();
+        for (auto *stat : stats)
+            stat->visit(out);
+        out.end();
+    }
+
+    std::vector<Dump>
+    readBack()
+    {
+        std::ifstream is(dirName + "/stats.bin", std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(is)),
+                         std::istreambuf_iterator<char>());
+        return Reader(data).dumps();
+    }
+
+    std::string dirName;
+};
+
+} // anonymous namespace
+
+/** Integral values are coded as zigzag deltas, unchanged ones skipped. */
+TEST_F(StatsBinaryTest, ZigzagDeltas)
+{
+    TestScalar a("a"), b("b"), c("c");
+    {
+        statistics::Binary out("stats.bin");
+        a.val = 5;
+        b.val = -3;
+        dump(out, 100, {&a, &b, &c});
+        a.val = 3;
+        b.val = 1LL << 40;
+        dump(out, 200, {&a, &b, &c});
+        dump(out, 300, {&a, &b, &c});
+        c.val = -(1LL << 52);
+        dump(out, 400, {&a, &b, &c});
+    }
+
+    const auto dumps = readBack();
+    ASSERT_EQ(dumps.size(), 4);
+    EXPECT_TRUE(dumps[0].newSchema);
+    EXPECT_EQ(dumps[0].names, std::vector<std::string>({"a", "b", "c"}));
+
+    EXPECT_EQ(dumps[0].tick, 100);
+    EXPECT_EQ(dumps[0].values, std::vector<double>({5, -3, 0}));
+    EXPECT_EQ(dumps[0].deltaColumns, std::vector<size_t>({0, 1}));
+
+    EXPECT_EQ(dumps[1].tick, 200);
+    EXPECT_EQ(dumps[1].values, std::vector<double>({3, 1LL << 40, 0}));
+    EXPECT_EQ(dumps[1].deltaColumns, std::vector<size_t>({0, 1}));
+
+    EXPECT_EQ(dumps[2].tick, 300);
+    EXPECT_TRUE(dumps[2].deltaColumns.empty());
+    EXPECT_TRUE(dumps[2].rawColumns.empty());
+    EXPECT_EQ(dumps[2].values, dumps[1].values);
+
+    EXPECT_EQ(dumps[3].values,
+              std::vector<double>({3, 1LL << 40, -(1LL << 52)}));
+    EXPECT_EQ(dumps[3].deltaColumns, std::vector<size_t>({2}));
+    EXPECT_TRUE(dumps[3].rawColumns.empty());
+}
+
+/** Values that are not integral, or follow one, are stored raw. */
+TEST_F(StatsBinaryTest, RawDoubles)
+{
+    TestScalar a("a"), b("b");
+    {
+        statistics::Binary out("stats.bin");
+        a.val = 0.25;
+        b.val = 1;
+        dump(out, 1, {&a, &b});
+        a.val = 2;
+        b.val = 1e300;
+        dump(out, 2, {&a, &b});
+        a.val = 7;
+        b.val = -1e-300;
+        dump(out, 3, {&a, &b});
+    }
+
+    const auto dumps = readBack();
+    ASSERT_EQ(dumps.size(), 3);
+
+    EXPECT_EQ(dumps[0].values, std::vector<double>({0.25, 1}));
+    EXPECT_EQ(dumps[0].rawColumns, std::vector<size_t>({0}));
+    EXPECT_EQ(dumps[0].deltaColumns, std::vector<size_t>({1}));
+
+    // 0.25 -> 2 is raw since the last value was not integral, and 1e300
+    // is too large to be coded as a delta
+    EXPECT_EQ(dumps[1].values, std::vector<double>({2, 1e300}));
+    EXPECT_EQ(dumps[1].rawColumns, std::vector<size_t>({0, 1}));
+
+    EXPECT_EQ(dumps[2].values, std::vector<double>({7, -1e-300}));
+    EXPECT_EQ(dumps[2].deltaColumns, std::vector<size_t>({0}));
+    EXPECT_EQ(dumps[2].rawColumns, std::vector<size_t>({1}));
+}
+
+/**
+ * A new schema is written when the stats change in the middle of the
+ * stream, and the values after it are deltas from zero.
+ */
+TEST_F(StatsBinaryTest, SchemaChange)
+{
+    TestScalar a("a"), b("b"), c("c");
+    {
+        statistics::Binary out("stats.bin");
+        a.val = 10;
+        b.val = 20;
+        dump(out, 1, {&a, &b});
+        a.val = 11;
+        dump(out, 2, {&a, &b});
+        c.val = 30;
+        dump(out, 3, {&a, &c, &b});
+        b.val = 21;
+        dump(out, 4, {&a, &c, &b});
+        dump(out, 5, {&b});
+    }
+
+    const auto dumps = readBack();
+    ASSERT_EQ(dumps.size(), 5);
+
+    EXPECT_TRUE(dumps[0].newSchema);
+    EXPECT_FALSE(dumps[1].newSchema);
+    EXPECT_EQ(dumps[1].values, std::vector<double>({11, 20}));
+    EXPECT_EQ(dumps[1].deltaColumns, std::vector<size_t>({0}));
+
+    EXPECT_TRUE(dumps[2].newSchema);
+    EXPECT_EQ(dumps[2].names, std::vector<std::string>({"a", "c", "b"}));
+    EXPECT_EQ(dumps[2].values, std::vector<double>({11, 30, 20}));
+    EXPECT_EQ(dumps[2].deltaColumns, std::vector<size_t>({0, 1, 2}));
+
+    EXPECT_FALSE(dumps[3].newSchema);
+    EXPECT_EQ(dumps[3].values, std::vector<double>({11, 30, 21}));
+    EXPECT_EQ(dumps[3].deltaColumns, std::vector<size_t>({2}));
+
+    EXPECT_TRUE(dumps[4].newSchema);
+    EXPECT_EQ(dumps[4].names, std::vector<std::string>({"b"}));
+    EXPECT_EQ(dumps[4].values, std::vector<double>({21}));
+}
@@ -0,0 +1,29 @@
+#include "base/stats/counter_bank.hh"
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+CounterBank::Count *
+CounterBank::allocate(size_type n)
+{
+    if (n > left) {
+        // a vector larger than a block gets consecutive blocks
+        size_type count = divCeil(n, blockSlots);
+        blocks.emplace_back(new Block[count]());
+        next = blocks.back()[0].slots;
+        left = count * blockSlots;
+    }
+
+    Count *slots = next;
+    next += n;
+    left -= n;
+    return slots;
+}
+
+} // namespace statistics
+} // namespace gem5
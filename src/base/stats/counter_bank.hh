@@ -0,0 +1,63 @@
+/**
+ * @file
+ * Contiguous storage for the counters of a statistics group.
+ */
+
+#ifndef __BASE_STATS_COUNTER_BANK_HH__
+#define __BASE_STATS_COUNTER_BANK_HH__
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Backing store of the banked counters (BankedScalar, BankedVector) of
+ * a Group. The counters of a group are handed out back to back from
+ * cache line aligned blocks, so the counters an object bumps on every
+ * event share a few lines instead of being spread over the stat
+ * objects, and their metadata (Info) stays out of the way. Counts are
+ * integers, which keeps the increments off the floating point adder.
+ *
+ * Slots never move once they are handed out and are zeroed when they
+ * are allocated.
+ */
+class CounterBank
+{
+  public:
+    typedef int64_t Count;
+
+    /** Counters per block, eight cache lines. */
+    static constexpr size_type blockSlots = 64;
+
+    CounterBank() = default;
+    CounterBank(const CounterBank &) = delete;
+    CounterBank &operator=(const CounterBank &) = delete;
+
+    /** Hand out n consecutive counters. */
+    Count *allocate(size_type n);
+
+  private:
+    struct alignas(64) Block
+    {
+        Count slots[blockSlots];
+    };
+
+    std::vector<std::unique_ptr<Block[]>> blocks;
+
+    /** The next free slot in the last block and how many are left. */
+    Count *next = nullptr;
+    size_type left = 0;
+};
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COUNTER_BANK_HH__
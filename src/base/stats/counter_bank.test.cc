@@ -0,0 +1,176 @@
+/**
+ * @file
+ * Allocation from the counter bank of a group, and the banked counters
+ * built on it used alone and in formulas.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "base/statistics.hh"
+#include "base/stats/counter_bank.hh"
+#include "sim/root.hh"
+
+using namespace gem5;
+
+// statistics.cc looks up unknown stat names through the Root, of which
+// there is none here
+Root *Root::_root = nullptr;
+
+using statistics::CounterBank;
+
+namespace
+{
+
+bool
+lineAligned(const void *p)
+{
+    return reinterpret_cast<uintptr_t>(p) % 64 == 0;
+}
+
+struct BankedStats : public statistics::Group
+{
+    statistics::BankedScalar hits;
+    statistics::BankedScalar misses;
+    statistics::BankedVector perBank;
+    statistics::Formula missRate;
+    statistics::Formula doubled;
+
+    BankedStats()
+        : statistics::Group(nullptr),
+          ADD_STAT(hits, statistics::units::Count::get(), "hits"),
+          ADD_STAT(misses, statistics::units::Count::get(), "misses"),
+          ADD_STAT(perBank, statistics::units::Count::get(),
+                   "accesses per bank"),
+          ADD_STAT(missRate, statistics::units::Ratio::get(), "miss rate",
+                   misses / (hits + misses)),
+          ADD_STAT(doubled, statistics::units::Count::get(),
+                   "twice the accesses per bank")
+    {
+        perBank.init(100);
+        doubled = perBank * 2;
+    }
+};
+
+} // anonymous namespace
+
+/** Small requests are handed out back to back from one aligned block. */
+TEST(CounterBankTest, BackToBack)
+{
+    CounterBank bank;
+    CounterBank::Count *a = bank.allocate(1);
+    CounterBank::Count *b = bank.allocate(3);
+    CounterBank::Count *c = bank.allocate(1);
+    EXPECT_TRUE(lineAligned(a));
+    EXPECT_EQ(b, a + 1);
+    EXPECT_EQ(c, a + 4);
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(a[i], 0);
+}
+
+/**
+ * A request that does not fit the rest of a block starts a new one, and
+ * the counters handed out before keep their place and value.
+ */
+TEST(CounterBankTest, NewBlockWhenFull)
+{
+    CounterBank bank;
+    CounterBank::Count *a = bank.allocate(CounterBank::blockSlots - 2);
+    a[0] = 7;
+    a[CounterBank::blockSlots - 3] = 8;
+
+    CounterBank::Count *b = bank.allocate(2);
+    EXPECT_EQ(b, a + CounterBank::blockSlots - 2);
+
+    CounterBank::Count *c = bank.allocate(1);
+    EXPECT_TRUE(lineAligned(c));
+    EXPECT_NE(c, a + CounterBank::blockSlots);
+    EXPECT_EQ(*c, 0);
+    EXPECT_EQ(a[0], 7);
+    EXPECT_EQ(a[CounterBank::blockSlots - 3], 8);
+}
+
+/**
+ * A vector larger than a block gets consecutive zeroed blocks, and the
+ * rest of the last one is used by the next requests.
+ */
+TEST(CounterBankTest, LargerThanBlock)
+{
+    CounterBank bank;
+    bank.allocate(10);
+
+    const size_t n = 2 * CounterBank::blockSlots + 10;
+    CounterBank::Count *v = bank.allocate(n);
+    EXPECT_TRUE(lineAligned(v));
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(v[i], 0);
+        v[i] = i;
+    }
+
+    CounterBank::Count *next = bank.allocate(CounterBank::blockSlots - 10);
+    EXPECT_EQ(next, v + n);
+    EXPECT_NE(bank.allocate(1), v + 3 * CounterBank::blockSlots);
+    for (size_t i = 0; i < n; i++)
+        EXPECT_EQ(v[i], i);
+}
+
+/** Banked counters count, total and reset like their unbanked versions. */
+TEST(CounterBankTest, BankedCounters)
+{
+    BankedStats stats;
+    stats.hits++;
+    ++stats.hits;
+    stats.hits += 5;
+    stats.misses = 3;
+    stats.misses--;
+    for (int i = 0; i < 100; i++)
+        stats.perBank[i] = i;
+
+    EXPECT_EQ(stats.hits.value(), 7);
+    EXPECT_EQ(stats.misses.value(), 2);
+    EXPECT_FALSE(stats.hits.zero());
+    EXPECT_EQ(stats.perBank.size(), 100);
+    EXPECT_EQ(stats.perBank.total(), 99 * 100 / 2);
+    statistics::VResult per_bank;
+    stats.perBank.result(per_bank);
+    ASSERT_EQ(per_bank.size(), 100);
+    EXPECT_EQ(per_bank[42], 42);
+
+    stats.resetStats();
+    EXPECT_TRUE(stats.hits.zero());
+    EXPECT_TRUE(stats.misses.zero());
+    EXPECT_TRUE(stats.perBank.zero());
+    EXPECT_EQ(stats.perBank.total(), 0);
+
+    // counting goes on in the same slots
+    stats.hits++;
+    stats.perBank[99] += 4;
+    EXPECT_EQ(stats.hits.value(), 1);
+    EXPECT_EQ(stats.perBank.total(), 4);
+}
+
+/** Banked counters are converted to Temps and read through formulas. */
+TEST(CounterBankTest, Formulas)
+{
+    BankedStats stats;
+    stats.hits = 6;
+    stats.misses = 2;
+    for (int i = 0; i < 100; i++)
+        stats.perBank[i] = i % 4;
+
+    EXPECT_DOUBLE_EQ(stats.missRate.total(), 0.25);
+    EXPECT_EQ(stats.doubled.size(), 100);
+    statistics::VResult doubled;
+    stats.doubled.result(doubled);
+    ASSERT_EQ(doubled.size(), 100);
+    EXPECT_EQ(doubled[3], 6);
+    EXPECT_EQ(doubled[4], 0);
+    EXPECT_EQ(stats.doubled.total(), 2 * 25 * (0 + 1 + 2 + 3));
+
+    // formulas follow the counters
+    stats.misses += 6;
+    EXPECT_DOUBLE_EQ(stats.missRate.total(), 8.0 / 14);
+    stats.resetStats();
+    EXPECT_TRUE(stats.doubled.zero());
+}
@@ -40,6 +40,7 @@
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
+#include "base/stats/counter_bank.hh"
 #include "base/stats/info.hh"
 #include "base/trace.hh"
 #include "debug/Stats.hh"
@@ -189,5 +190,13 @@ Group::getStats() const
     return stats;
 }
 
+CounterBank &
+Group::counterBank()
+{
+    if (!counters)
+        counters.reset(new CounterBank());
+    return *counters;
+}
+
 } // namespace statistics
 } // namespace gem5
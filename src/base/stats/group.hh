@@ -39,6 +39,7 @@
 #define __BASE_STATS_GROUP_HH__
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,7 @@ GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
 namespace statistics
 {
 
+class CounterBank;
 class Info;
 
 /**
@@ -177,6 +179,14 @@ class Group
      */
     const std::vector<Info *> &getStats() const;
 
+    /**
+     * Get the storage of the banked counters of this group, which is
+     * created when the first one is added.
+     *
+     * @ingroup api_stats
+     */
+    CounterBank &counterBank();
+
      /**
      * Add a stat block as a child of this block
      *
@@ -219,6 +229,8 @@ class Group
     std::map<std::string, Group *> statGroups;
     std::vector<Group *> mergedStatGroups;
     std::vector<Info *> stats;
+
+    std::unique_ptr<CounterBank> counters;
 };
 
 } // namespace statistics
@@ -139,7 +139,7 @@ CheckerCPU::unserialize(CheckpointIn &cp)
 RequestPtr
 CheckerCPU::genMemFragmentRequest(Addr frag_addr, int size,
                                   Request::Flags flags,
-                                  const std::vector<bool>& byte_enable,
+                                  const ByteEnable &byte_enable,
                                   int& frag_size, int& size_left) const
 {
     frag_size = std::min(
@@ -150,14 +150,12 @@ CheckerCPU::genMemFragmentRequest(Addr frag_addr, int size,
     RequestPtr mem_req;
 
     // Set up byte-enable mask for the current fragment
-    auto it_start = byte_enable.cbegin() + (size - (frag_size +
-                                                    size_left));
-    auto it_end = byte_enable.cbegin() + (size - size_left);
-    if (isAnyActiveElement(it_start, it_end)) {
+    unsigned frag_start = size - (frag_size + size_left);
+    if (byte_enable.any(frag_start, frag_size)) {
         mem_req = std::make_shared<Request>(frag_addr, frag_size,
                 flags, requestorId, thread->pcState().instAddr(),
                 tc->contextId());
-        mem_req->setByteEnable(std::vector<bool>(it_start, it_end));
+        mem_req->setByteEnable(byte_enable.slice(frag_start, frag_size));
     }
 
     return mem_req;
@@ -166,7 +164,7 @@ CheckerCPU::genMemFragmentRequest(Addr frag_addr, int size,
 Fault
 CheckerCPU::readMem(Addr addr, uint8_t *data, unsigned size,
                     Request::Flags flags,
-                    const std::vector<bool>& byte_enable)
+                    const ByteEnable &byte_enable)
 {
     assert(byte_enable.size() == size);
 
@@ -250,7 +248,7 @@ CheckerCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 Fault
 CheckerCPU::writeMem(uint8_t *data, unsigned size,
                      Addr addr, Request::Flags flags, uint64_t *res,
-                     const std::vector<bool>& byte_enable)
+                     const ByteEnable &byte_enable)
 {
     assert(byte_enable.size() == size);
 
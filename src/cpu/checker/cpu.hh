@@ -381,16 +381,16 @@ class CheckerCPU : public BaseCPU, public ExecContext
      */
     RequestPtr genMemFragmentRequest(Addr frag_addr, int size,
                                      Request::Flags flags,
-                                     const std::vector<bool>& byte_enable,
+                                     const ByteEnable &byte_enable,
                                      int& frag_size, int& size_left) const;
 
     Fault readMem(Addr addr, uint8_t *data, unsigned size,
                   Request::Flags flags,
-                  const std::vector<bool>& byte_enable) override;
+                  const ByteEnable &byte_enable) override;
 
     Fault writeMem(uint8_t *data, unsigned size, Addr addr,
                    Request::Flags flags, uint64_t *res,
-                   const std::vector<bool>& byte_enable) override;
+                   const ByteEnable &byte_enable) override;
 
     Fault
     amoMem(Addr addr, uint8_t* data, unsigned size,
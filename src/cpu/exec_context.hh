@@ -124,7 +124,7 @@ class ExecContext
      */
     virtual Fault
     readMem(Addr addr, uint8_t *data, unsigned int size,
-            Request::Flags flags, const std::vector<bool>& byte_enable)
+            Request::Flags flags, const ByteEnable &byte_enable)
     {
         panic("ExecContext::readMem() should be overridden\n");
     }
@@ -138,7 +138,7 @@ class ExecContext
      */
     virtual Fault
     initiateMemRead(Addr addr, unsigned int size,
-            Request::Flags flags, const std::vector<bool>& byte_enable)
+            Request::Flags flags, const ByteEnable &byte_enable)
     {
         panic("ExecContext::initiateMemRead() should be overridden\n");
     }
@@ -158,7 +158,7 @@ class ExecContext
      */
     virtual Fault writeMem(uint8_t *data, unsigned int size, Addr addr,
                            Request::Flags flags, uint64_t *res,
-                           const std::vector<bool>& byte_enable) = 0;
+                           const ByteEnable &byte_enable) = 0;
 
     /**
      * For atomic-mode contexts, perform an atomic AMO (a.k.a., Atomic
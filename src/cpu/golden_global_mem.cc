@@ -66,7 +66,7 @@ GoldenGloablMem::updateGoldenMem(uint64_t addr, void *data, uint64_t mask, int l
 }
 
 void
-GoldenGloablMem::updateGoldenMem(uint64_t addr, void *data, const std::vector<bool>& mask, int len)
+GoldenGloablMem::updateGoldenMem(uint64_t addr, void *data, const ByteEnable &mask, int len)
 {
     uint8_t *dataArray = (uint8_t *)data;
     for (int i = 0; i < len; i++) {
@@ -22,6 +22,8 @@
 
 #include <base/types.hh>
 
+#include "mem/byte_enable.hh"
+
 namespace gem5
 {
 
@@ -38,7 +40,7 @@ class GoldenGloablMem
     uint64_t hostToGuest(void *addr);
 
     void updateGoldenMem(uint64_t addr, void *data, uint64_t mask, int len);
-    void updateGoldenMem(uint64_t addr, void *data, const std::vector<bool>& mask, int len);
+    void updateGoldenMem(uint64_t addr, void *data, const ByteEnable &mask, int len);
     void pmemWriteCheck(uint64_t addr, uint64_t data, int len);
     void pmemWrite(uint64_t addr, uint64_t data, int len);
 
@@ -108,7 +108,7 @@ class ExecContext : public gem5::ExecContext
     Fault
     initiateMemRead(Addr addr, unsigned int size,
                     Request::Flags flags,
-                    const std::vector<bool>& byte_enable) override
+                    const ByteEnable &byte_enable) override
     {
         assert(byte_enable.size() == size);
         return execute.getLSQ().pushRequest(inst, true /* load */, nullptr,
@@ -126,7 +126,7 @@ class ExecContext : public gem5::ExecContext
     Fault
     writeMem(uint8_t *data, unsigned int size, Addr addr,
              Request::Flags flags, uint64_t *res,
-             const std::vector<bool>& byte_enable)
+             const ByteEnable &byte_enable)
         override
     {
         assert(byte_enable.size() == size);
@@ -141,7 +141,7 @@ class ExecContext : public gem5::ExecContext
         // AMO requests are pushed through the store path
         return execute.getLSQ().pushRequest(inst, false /* amo */, nullptr,
             size, addr, flags, nullptr, std::move(amo_op),
-            std::vector<bool>(size, true));
+            ByteEnable(size, true));
     }
 
     RegVal
@@ -305,7 +305,7 @@ LSQ::SingleDataRequest::startAddrTranslation()
         inst->id.threadId);
 
     const auto &byte_enable = request->getByteEnable();
-    if (isAnyActiveElement(byte_enable.cbegin(), byte_enable.cend())) {
+    if (byte_enable.any()) {
         port.numAccessesInDTLB++;
 
         setState(LSQ::LSQRequest::InTranslation);
@@ -426,8 +426,6 @@ LSQ::SplitDataRequest::makeFragmentRequests()
     unsigned int fragment_size;
     Addr fragment_addr;
 
-    std::vector<bool> fragment_write_byte_en;
-
     /* Assume that this transfer is across potentially many block snap
      * boundaries:
      *
@@ -499,16 +497,14 @@ LSQ::SplitDataRequest::makeFragmentRequests()
 
         fragment->setContext(request->contextId());
         // Set up byte-enable mask for the current fragment
-        auto it_start = byte_enable.begin() +
-            (fragment_addr - base_addr);
-        auto it_end = byte_enable.begin() +
-            (fragment_addr - base_addr) + fragment_size;
-        if (isAnyActiveElement(it_start, it_end)) {
+        unsigned int fragment_start = fragment_addr - base_addr;
+        if (byte_enable.any(fragment_start, fragment_size)) {
             fragment->setVirt(
                 fragment_addr, fragment_size, request->getFlags(),
                 request->requestorId(),
                 request->getPC());
-            fragment->setByteEnable(std::vector<bool>(it_start, it_end));
+            fragment->setByteEnable(
+                byte_enable.slice(fragment_start, fragment_size));
         } else {
             disabled_fragment = true;
         }
@@ -1584,7 +1580,7 @@ Fault
 LSQ::pushRequest(MinorDynInstPtr inst, bool isLoad, uint8_t *data,
                  unsigned int size, Addr addr, Request::Flags flags,
                  uint64_t *res, AtomicOpFunctorPtr amo_op,
-                 const std::vector<bool>& byte_enable)
+                 const ByteEnable &byte_enable)
 {
     assert(inst->translationFault == NoFault || inst->inLSQ);
 
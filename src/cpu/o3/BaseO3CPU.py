@@ -216,5 +216,22 @@ class BaseO3CPU(BaseCPU):
 
     arch_db = Param.ArchDBer(Parent.any, "Arch DB")
 
+    pipe_trace_file = Param.String("", "Write the pipeline stages of "
+                                   "committed instructions to this file in "
+                                   "the output directory, see "
+                                   "util/o3-pipetrace.py")
+
+    hotspot_profile_file = Param.String("", "Sample the PC at the ROB head "
+                                        "and its stall reason into a pprof "
+                                        "profile with this name in the "
+                                        "output directory, e.g. "
+                                        "hotspot.pb.gz")
+    hotspot_profile_interval = Param.Cycles(100, "Cycles between samples "
+                                            "of the hotspot profile")
+
     store_prefetch_train = Param.Bool(True, "Training store prefetcher with store addresses")
 
+    idleCycleSkip = Param.Bool(False, "Deschedule the CPU over cycles in "
+                               "which the pipeline only waits on a load "
+                               "miss at the ROB head")
+
@@ -36,7 +36,7 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-from m5.SimObject import SimObject
+from m5.SimObject import PyBindMethod, SimObject
 from m5.params import *
 from m5.objects.FuncUnit import *
 from m5.objects.FuncUnitConfig import *
@@ -114,6 +114,7 @@ class Scheduler(SimObject):
     type = 'Scheduler'
     cxx_class = 'gem5::o3::Scheduler'
     cxx_header = "cpu/o3/issue_queue.hh"
+    cxx_exports = [PyBindMethod("setOpLatency")]
 
     IQs = VectorParam.IssueQue([], "")
     slotNum = Param.Int(16, "number of schedule slots")
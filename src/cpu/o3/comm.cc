@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2004-2006 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/comm.hh"
+
+#include <algorithm>
+#include <map>
+
+#include "cpu/o3/dyn_inst.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+const char *
+stallReasonName(StallReason reason)
+{
+    static const std::map<StallReason, const char *> names = {
+        {StallReason::NoStall, "NoStall"},
+        {StallReason::IcacheStall, "IcacheStall"},
+        {StallReason::ITlbStall, "ITlbStall"},
+        {StallReason::DTlbStall, "DTlbStall"},
+        {StallReason::BpStall, "BpStall"},
+        {StallReason::IntStall, "IntStall"},
+        {StallReason::TrapStall, "TrapStall"},
+        {StallReason::FragStall, "FragStall"},
+        {StallReason::SquashStall, "SquashStall"},
+        {StallReason::FetchBufferInvalid, "FetchBufferInvalid"},
+        {StallReason::InstMisPred, "InstMisPred"},
+        {StallReason::InstSquashed, "InstSquashed"},
+        {StallReason::SerializeStall, "SerializeStall"},
+        {StallReason::VectorLongExecute, "VectorLongExecute"},
+        {StallReason::ScalarLongExecute, "ScalarLongExecute"},
+        {StallReason::InstNotReady, "InstNotReady"},
+        {StallReason::LoadL1Bound, "LoadL1Bound"},
+        {StallReason::LoadL2Bound, "LoadL2Bound"},
+        {StallReason::LoadL3Bound, "LoadL3Bound"},
+        {StallReason::LoadMemBound, "LoadMemBound"},
+        {StallReason::StoreL1Bound, "StoreL1Bound"},
+        {StallReason::StoreL2Bound, "StoreL2Bound"},
+        {StallReason::StoreL3Bound, "StoreL3Bound"},
+        {StallReason::StoreMemBound, "StoreMemBound"},
+        {StallReason::MemSquashed, "MemSquashed"},
+        {StallReason::Atomic,"Atomic"},
+        {StallReason::ResumeUnblock, "ResumeUnblock"},
+        {StallReason::CommitSquash, "CommitSquash"},
+        {StallReason::OtherStall, "OtherStall"},
+        {StallReason::OtherFetchStall, "OtherFetchStall"},
+
+        {StallReason::MemDQBandwidth, "MemDQBandwidth"},
+        {StallReason::FVDQBandwidth, "FVDQBandwidth"},
+        {StallReason::IntDQBandwidth, "IntDQBandwidth"},
+        {StallReason::MemNotReady, "MemNotReady"},
+        {StallReason::MemCommitRateLimit, "MemCommitRateLimit"},
+        {StallReason::OtherMemStall, "OtherMemStall"},
+        {StallReason::VectorReadyButNotIssued, "VectorReadyButNotIssued"},
+        {StallReason::ScalarReadyButNotIssued, "ScalarReadyButNotIssued"}
+    };
+
+    return names.at(reason);
+}
+
+const char *
+ftqStateName(FtqState state)
+{
+    switch (state) {
+      case FtqState::None: return "none";
+      case FtqState::Empty: return "empty";
+      case FtqState::Partial: return "partial";
+      case FtqState::Full: return "full";
+    }
+    return "unknown";
+}
+
+void
+FetchStruct::reset()
+{
+    std::fill(insts, insts + size, nullptr);
+    size = 0;
+    fetchFault = NoFault;
+    fetchFaultSN = 0;
+    clearFetchFault = false;
+    fetchStallReason.clear();
+}
+
+void
+DecodeStruct::reset()
+{
+    std::fill(insts, insts + size, nullptr);
+    size = 0;
+    fetchStallReason.clear();
+    decodeStallReason.clear();
+}
+
+void
+RenameStruct::reset()
+{
+    std::fill(insts, insts + size, nullptr);
+    size = 0;
+    fetchStallReason.clear();
+    decodeStallReason.clear();
+    renameStallReason.clear();
+}
+
+void
+TimeStruct::reset()
+{
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        // mispredPC, branchAddr and branchCount are never written
+        DecodeComm &decode = decodeInfo[tid];
+        decode.nextPC.reset();
+        decode.mispredictInst = nullptr;
+        decode.squashInst = nullptr;
+        decode.doneSeqNum = 0;
+        decode.squash = false;
+        decode.predIncorrect = false;
+        decode.branchMispredict = false;
+        decode.branchTaken = false;
+        decode.blockReason = NoStall;
+
+        renameInfo[tid].blockReason = NoStall;
+
+        // every field of it is written, and it holds plain values only
+        iewInfo[tid] = IewComm();
+
+        CommitComm &commit = commitInfo[tid];
+        commit.pc.reset();
+        commit.committedPC = 0;
+        commit.mispredictInst = nullptr;
+        commit.squashInst = nullptr;
+        commit.strictlyOrderedLoad = nullptr;
+        commit.nonSpecSeqNum = 0;
+        commit.doneSeqNum = 0;
+        commit.doneFsqId = 0;
+        commit.squashedStreamId = 0;
+        commit.squashedTargetId = 0;
+        commit.squashedLoopIter = 0;
+        commit.freeROBEntries = 0;
+        commit.isTrapSquash = false;
+        commit.squash = false;
+        commit.robSquashing = false;
+        commit.squashVersion = SquashVersion();
+        commit.usedROB = false;
+        commit.emptyROB = false;
+        commit.branchTaken = false;
+        commit.interruptPending = false;
+        commit.clearInterrupt = false;
+        commit.strictlyOrdered = false;
+    }
+
+    std::fill_n(decodeBlock, MaxThreads, false);
+    std::fill_n(decodeUnblock, MaxThreads, false);
+    std::fill_n(renameBlock, MaxThreads, false);
+    std::fill_n(renameUnblock, MaxThreads, false);
+    std::fill_n(iewBlock, MaxThreads, false);
+    std::fill_n(iewUnblock, MaxThreads, false);
+}
+
+} // namespace o3
+} // namespace gem5
@@ -42,6 +42,8 @@
 #ifndef __CPU_O3_COMM_HH__
 #define __CPU_O3_COMM_HH__
 
+#include <algorithm>
+#include <cassert>
 #include <vector>
 
 #include "arch/generic/pcstate.hh"
@@ -103,6 +105,51 @@ enum StallReason {
     NumStallReasons
 };
 
+/** Name of a stall reason in the stats. */
+const char *stallReasonName(StallReason reason);
+
+/** How full the fetch target queue of a decoupled frontend is. */
+enum class FtqState : uint8_t
+{
+    None,  // not a decoupled FTB frontend
+    Empty,
+    Partial,
+    Full
+};
+
+const char *ftqStateName(FtqState state);
+
+/**
+ * Stall reasons of each slot of a stage, stored inline so the structs
+ * passed through the time buffers never allocate.
+ */
+class StallReasons
+{
+  public:
+    StallReasons &
+    operator=(const std::vector<StallReason> &reasons)
+    {
+        assert(reasons.size() <= MaxWidth);
+        num = reasons.size();
+        std::copy(reasons.begin(), reasons.end(), slots);
+        return *this;
+    }
+
+    size_t size() const { return num; }
+    bool empty() const { return num == 0; }
+    void clear() { num = 0; }
+
+    StallReason &operator[](size_t i) { assert(i < num); return slots[i]; }
+    StallReason operator[](size_t i) const { assert(i < num); return slots[i]; }
+
+    const StallReason *begin() const { return slots; }
+    const StallReason *end() const { return slots + num; }
+
+  private:
+    StallReason slots[MaxWidth];
+    unsigned num = 0;
+};
+
 /** Struct that defines the information passed from fetch to decode. */
 struct FetchStruct
 {
@@ -112,7 +159,10 @@ struct FetchStruct
     Fault fetchFault;
     InstSeqNum fetchFaultSN;
     bool clearFetchFault;
-    std::vector<StallReason> fetchStallReason;
+    StallReasons fetchStallReason;
+
+    /** Cheaper equivalent of rebuilding the struct from zeroed memory. */
+    void reset();
 };
 
 /** Struct that defines the information passed from decode to rename. */
@@ -121,8 +171,10 @@ struct DecodeStruct
     int size;
 
     DynInstPtr insts[MaxWidth];
-    std::vector<StallReason> fetchStallReason;
-    std::vector<StallReason> decodeStallReason;
+    StallReasons fetchStallReason;
+    StallReasons decodeStallReason;
+
+    void reset();
 };
 
 /** Struct that defines the information passed from rename to IEW. */
@@ -131,9 +183,11 @@ struct RenameStruct
     int size;
 
     DynInstPtr insts[MaxWidth];
-    std::vector<StallReason> fetchStallReason;
-    std::vector<StallReason> decodeStallReason;
-    std::vector<StallReason> renameStallReason;
+    StallReasons fetchStallReason;
+    StallReasons decodeStallReason;
+    StallReasons renameStallReason;
+
+    void reset();
 };
 
 /** Struct that defines the information passed from IEW to commit. */
@@ -324,6 +378,12 @@ struct TimeStruct
     bool renameUnblock[MaxThreads];
     bool iewBlock[MaxThreads];
     bool iewUnblock[MaxThreads];
+
+    /**
+     * Cheaper equivalent of rebuilding the struct from zeroed memory. Only
+     * the fields the stages write are cleared, the others stay zero.
+     */
+    void reset();
 };
 
 } // namespace o3
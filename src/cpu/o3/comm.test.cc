@@ -0,0 +1,155 @@
+/**
+ * @file
+ * Resets of the backwards communication struct of the O3 time buffer:
+ * after the stages wrote it, an entry must come back exactly as it was
+ * when the buffer zeroed and constructed it.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "arch/generic/pcstate.hh"
+#include "cpu/o3/comm.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "cpu/timebuf.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+/** A TimeStruct built the way TimeBuffer built every entry before. */
+class ZeroedTimeStruct
+{
+  public:
+    ZeroedTimeStruct()
+    {
+        std::memset(storage, 0, sizeof(storage));
+        new (storage) TimeStruct;
+    }
+
+    ~ZeroedTimeStruct() { get().~TimeStruct(); }
+
+    TimeStruct &get() { return *reinterpret_cast<TimeStruct *>(storage); }
+
+  private:
+    alignas(TimeStruct) unsigned char storage[sizeof(TimeStruct)];
+};
+
+std::unique_ptr<PCStateBase>
+somePC(Addr addr)
+{
+    return std::make_unique<GenericISA::SimplePCState<4>>(addr);
+}
+
+/** Write every field that fetch, decode, rename, IEW and commit write. */
+void
+writeAsStages(TimeStruct &t)
+{
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        auto &decode = t.decodeInfo[tid];
+        decode.nextPC = somePC(0x1000 + tid);
+        decode.doneSeqNum = 10;
+        decode.squash = true;
+        decode.predIncorrect = true;
+        decode.branchMispredict = true;
+        decode.branchTaken = true;
+        decode.blockReason = BpStall;
+
+        t.renameInfo[tid].blockReason = SerializeStall;
+
+        auto &iew = t.iewInfo[tid];
+        iew.freeLQEntries = 1;
+        iew.freeSQEntries = 2;
+        iew.dispatchedToLQ = 3;
+        iew.dispatchedToSQ = 4;
+        iew.ldstqCount = 5;
+        iew.dispatched = 6;
+        iew.usedIQ = true;
+        iew.usedLSQ = true;
+        iew.robHeadStallReason = LoadL2Bound;
+        iew.blockReason = MemNotReady;
+        iew.lqHeadStallReason = LoadMemBound;
+        iew.sqHeadStallReason = StoreL1Bound;
+
+        auto &commit = t.commitInfo[tid];
+        commit.pc = somePC(0x2000 + tid);
+        commit.committedPC = 0x2000;
+        commit.nonSpecSeqNum = 11;
+        commit.doneSeqNum = 12;
+        commit.doneFsqId = 13;
+        commit.squashedStreamId = 14;
+        commit.squashedTargetId = 15;
+        commit.squashedLoopIter = 16;
+        commit.freeROBEntries = 17;
+        commit.isTrapSquash = true;
+        commit.squash = true;
+        commit.robSquashing = true;
+        commit.squashVersion.update(3);
+        commit.usedROB = true;
+        commit.emptyROB = true;
+        commit.branchTaken = true;
+        commit.interruptPending = true;
+        commit.clearInterrupt = true;
+        commit.strictlyOrdered = true;
+
+        t.decodeBlock[tid] = true;
+        t.decodeUnblock[tid] = true;
+        t.renameBlock[tid] = true;
+        t.renameUnblock[tid] = true;
+        t.iewBlock[tid] = true;
+        t.iewUnblock[tid] = true;
+    }
+}
+
+bool
+sameBytes(const TimeStruct &a, const TimeStruct &b)
+{
+    return std::memcmp(&a, &b, sizeof(TimeStruct)) == 0;
+}
+
+} // anonymous namespace
+
+/** reset() leaves the same bytes as zeroing and constructing. */
+TEST(TimeStructTest, ResetMatchesZeroed)
+{
+    ZeroedTimeStruct written, fresh;
+    writeAsStages(written.get());
+    EXPECT_FALSE(sameBytes(written.get(), fresh.get()));
+
+    written.get().reset();
+    EXPECT_TRUE(sameBytes(written.get(), fresh.get()));
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        EXPECT_EQ(written.get().decodeInfo[tid].nextPC, nullptr);
+        EXPECT_EQ(written.get().commitInfo[tid].pc, nullptr);
+    }
+
+    // and again, as the buffer reuses its entries
+    writeAsStages(written.get());
+    written.get().reset();
+    EXPECT_TRUE(sameBytes(written.get(), fresh.get()));
+}
+
+/** The time buffer resets an entry when it comes back into the future. */
+TEST(TimeStructTest, TimeBufferAdvance)
+{
+    TimeBuffer<TimeStruct> buffer(2, 1);
+    ZeroedTimeStruct fresh;
+
+    writeAsStages(buffer[0]);
+    buffer[1].iewInfo[0].dispatched = 7;
+    buffer.advance();
+    // the old present is now the past, and still readable
+    EXPECT_EQ(buffer[-1].iewInfo[0].ldstqCount, 5);
+    EXPECT_EQ(buffer[0].iewInfo[0].dispatched, 7);
+    EXPECT_TRUE(sameBytes(buffer[1], fresh.get()));
+
+    buffer.advance();
+    buffer.advance();
+    // the written entry went around to the future
+    EXPECT_TRUE(sameBytes(buffer[1], fresh.get()));
+}
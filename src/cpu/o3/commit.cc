@@ -800,6 +800,39 @@ Commit::tick()
     updateStatus();
 }
 
+bool
+Commit::isQuiescent() const
+{
+    if (numThreads != 1 || drainPending || interrupt != NoFault ||
+        commitStatus[0] != Running || trapSquash[0] || tcSquash[0] ||
+        changedROBNumEntries[0]) {
+        return false;
+    }
+
+    if (fromIEW->size || fromIEW->squash[0] || fromRename->size)
+        return false;
+
+    if (FullSystem && cpu->checkInterrupts(0))
+        return false;
+
+    if (rob->isEmpty(0))
+        return false;
+
+    const DynInstPtr &head_inst = rob->readHeadInst(0);
+    return head_inst->isLoad() && head_inst->isIssued() &&
+        !head_inst->isExecuted() && !head_inst->readyToCommit();
+}
+
+void
+Commit::creditQuiescentCycles(Cycles cycles)
+{
+    stats.numCommittedDist.sample(0, cycles);
+
+    const DynInstPtr &head_inst = rob->readHeadInst(0);
+    for (Cycles i(0); i < cycles; ++i)
+        ppCommitStall->notify(head_inst);
+}
+
 void
 Commit::handleInterrupt()
 {
@@ -1670,11 +1703,13 @@ Commit::commitHead(const DynInstPtr &head_inst, unsigned inst_num)
     rob->retireHead(tid);
 
 #if TRACING_ON
-    if (debug::O3PipeView) {
+    if (cpu->recordStageTicks()) {
         head_inst->commitTick = curTick() - head_inst->fetchTick;
         DPRINTF(O3PipeView, "Record commit for inst sn:%lu, commitTick=%lu\n",
                 head_inst->seqNum, head_inst->commitTick);
     }
+    if (cpu->pipeTrace)
+        cpu->pipeTrace->record(head_inst);
 #endif
 
     // If this was a store, record it for this cycle.
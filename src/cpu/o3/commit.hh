@@ -226,6 +226,16 @@ class Commit
     /** Ticks the commit stage, which tries to commit instructions. */
     void tick();
 
+    /**
+     * Is commit waiting on an issued load at the ROB head with no squash,
+     * trap or interrupt pending? Only the completion of that load (or an
+     * interrupt) can change what commit does in a cycle.
+     */
+    bool isQuiescent() const;
+
+    /** Credits the per-cycle accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
+
     /** Handles any squashes that are sent from IEW, and adds instructions
      * to the ROB and tries to commit instructions.
      */
@@ -43,6 +43,8 @@
 #include "cpu/o3/cpu.hh"
 
 #include <cassert>
+#include <initializer_list>
+#include <utility>
 
 #include "arch/riscv/regs/misc.hh"
 #include "config/the_isa.hh"
@@ -122,6 +124,8 @@ CPU::CPU(const BaseO3CPUParams &params)
       globalSeqNum(1),
       system(params.system),
       lastRunningCycle(curCycle()),
+      idleCycleSkip(params.idleCycleSkip),
+      quiescentThreshold(params.backComSize + params.forwardComSize + 1),
       archDBer(params.arch_db),
       ipc_r("ipc", "", 1000, archDBer),
       cpi_r("cpi", "", 1000, archDBer),
@@ -134,6 +138,18 @@ CPU::CPU(const BaseO3CPUParams &params)
             "More workload items (%d) than threads (%d) on CPU %s.",
             params.workload.size(), params.numThreads, name());
 
+    if (!params.pipe_trace_file.empty()) {
+        fatal_if(!TRACING_ON, "%s: pipeline traces need a build with "
+                 "tracing on.\n", name());
+        pipeTrace.reset(new PipeTrace(params.pipe_trace_file,
+                                      clockPeriod()));
+    }
+
+    if (!params.hotspot_profile_file.empty()) {
+        hotspotProfiler.reset(new HotspotProfiler(
+            params.hotspot_profile_file, params.hotspot_profile_interval));
+    }
+
     if (!params.switched_out) {
         _status = Running;
     } else {
@@ -348,6 +364,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
       ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
                "Total number of cycles that CPU has spent quiesced or waiting "
                "for an interrupt"),
+      ADD_STAT(skippedCycles, statistics::units::Cycle::get(),
+               "Total number of quiescent cycles skipped while waiting on a "
+               "load miss"),
       ADD_STAT(committedInsts, statistics::units::Count::get(),
                "Number of Instructions Simulated"),
       ADD_STAT(committedOps, statistics::units::Count::get(),
@@ -401,6 +420,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
     quiesceCycles
         .prereq(quiesceCycles);
 
+    skippedCycles
+        .prereq(skippedCycles);
+
     // Number of Instructions simulated
     // --------------------------------
     // Should probably be in Base CPU but need templated
@@ -473,6 +495,9 @@ CPU::tick()
     assert(!switchedOut());
     assert(drainState() != DrainState::Drained);
 
+    if (idleSkipping)
+        creditSkippedCycles();
+
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -489,6 +514,11 @@ CPU::tick()
 
     commit.tick();
 
+    if (hotspotProfiler) {
+        if (unsigned samples = hotspotProfiler->tick())
+            sampleHotspots(samples);
+    }
+
     // Now advance the time buffers
     timeBuffer.advance();
 
@@ -503,6 +533,13 @@ CPU::tick()
         cleanUpRemovedInsts();
     }
 
+    if (idleCycleSkip) {
+        if (pipelineQuiescent() && stallPatternSteady())
+            ++quiescentTicks;
+        else
+            quiescentTicks = 0;
+    }
+
     if (!tickEvent.scheduled()) {
         if (_status == SwitchedOut) {
             DPRINTF(O3CPU, "Switched out!\n");
@@ -512,6 +549,10 @@ CPU::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             cpuStats.timesIdled++;
+        } else if (quiescentTicks >= quiescentThreshold) {
+            DPRINTF(O3CPU, "Quiescent, skipping cycles until woken!\n");
+            lastRunningCycle = curCycle();
+            idleSkipping = true;
         } else {
             lastRunningCycle = curCycle();
             schedule(tickEvent, clockEdge(Cycles(1)));
@@ -525,6 +566,87 @@ CPU::tick()
     tryDrain();
 }
 
+bool
+CPU::pipelineQuiescent()
+{
+    if (_status != Running || activeThreads.size() != 1 ||
+        drainState() != DrainState::Running || removeInstsThisCycle) {
+        return false;
+    }
+
+    return commit.isQuiescent() && iew.isQuiescent() &&
+        rename.isQuiescent() && decode.isQuiescent() && fetch.isQuiescent();
+}
+
+bool
+CPU::stallPatternSteady()
+{
+    // The time buffers have already advanced, so rename's output of this
+    // tick sits one slot in the past.
+    const RenameStruct *to_iew = renameQueue.access(-1);
+
+    stallPattern.clear();
+    for (const auto *reasons : {&to_iew->fetchStallReason,
+                                &to_iew->decodeStallReason,
+                                &to_iew->renameStallReason}) {
+        stallPattern.insert(stallPattern.end(), reasons->begin(),
+                            reasons->end());
+    }
+
+    bool steady = stallPattern == lastStallPattern;
+    std::swap(stallPattern, lastStallPattern);
+    return steady;
+}
+
+void
+CPU::creditSkippedCycles()
+{
+    idleSkipping = false;
+    quiescentTicks = 0;
+
+    Cycles skipped(curCycle() - lastRunningCycle - 1);
+    if (skipped == 0)
+        return;
+
+    DPRINTF(O3CPU, "Crediting %llu skipped quiescent cycles\n",
+            (uint64_t)skipped);
+
+    baseStats.numCycles += skipped;
+    cpuStats.skippedCycles += skipped;
+
+    fetch.creditQuiescentCycles(skipped);
+    decode.creditQuiescentCycles(skipped);
+    rename.creditQuiescentCycles(skipped);
+    iew.creditQuiescentCycles(skipped);
+    commit.creditQuiescentCycles(skipped);
+
+    if (hotspotProfiler)
+        hotspotProfiler->skip(skipped);
+}
+
+void
+CPU::sampleHotspots(unsigned samples)
+{
+    const FtqState ftq = fetch.ftqState();
+    for (ThreadID tid : activeThreads) {
+        // what IEW tells rename this cycle
+        const auto &iew_info = timeBuffer.getWire(0)->iewInfo[tid];
+
+        // blame a full LSQ as rename does when the ROB head is fine
+        StallReason reason = iew_info.robHeadStallReason;
+        if (reason == StallReason::NoStall) {
+            if (iew.ldstQueue.lqFull(tid))
+                reason = iew_info.lqHeadStallReason;
+            else if (iew.ldstQueue.sqFull(tid))
+                reason = iew_info.sqHeadStallReason;
+        }
+
+        Addr pc = rob.isEmpty(tid) ? 0 :
+            rob.readHeadInst(tid)->pcState().instAddr();
+        hotspotProfiler->sample(pc, reason, ftq, samples);
+    }
+}
+
 void
 CPU::init()
 {
@@ -1446,6 +1568,13 @@ CPU::wakeDependents(const DynInstPtr &inst)
 void
 CPU::wakeCPU()
 {
+    if (idleSkipping) {
+        DPRINTF(Activity, "Waking up CPU from skipped cycles\n");
+        // A wakeup in the cycle the CPU stopped in must not tick it twice.
+        scheduleTickEvent(Cycles(curCycle() > lastRunningCycle ? 0 : 1));
+        return;
+    }
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -1467,6 +1596,10 @@ CPU::wakeCPU()
 void
 CPU::wakeup(ThreadID tid)
 {
+    // Posted interrupts end a skipped stretch as well.
+    if (idleSkipping)
+        wakeCPU();
+
     if (thread[tid]->status() != gem5::ThreadContext::Suspended)
         return;
 
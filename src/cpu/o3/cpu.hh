@@ -45,6 +45,7 @@
 
 #include <iostream>
 #include <list>
+#include <memory>
 #include <queue>
 #include <set>
 #include <vector>
@@ -62,14 +63,17 @@
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
+#include "cpu/o3/hotspot_profiler.hh"
 #include "cpu/o3/iew.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/pipe_trace.hh"
 #include "cpu/o3/rename.hh"
 #include "cpu/o3/rob.hh"
 #include "cpu/o3/scoreboard.hh"
 #include "cpu/o3/thread_state.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/timebuf.hh"
+#include "debug/O3PipeView.hh"
 #include "mem/cache/prefetch/base.hh"
 #include "params/BaseO3CPU.hh"
 #include "sim/process.hh"
@@ -564,6 +568,48 @@ class CPU : public BaseCPU
     /** The cycle that the CPU was last running, used for statistics. */
     Cycles lastRunningCycle;
 
+    /** Whether the CPU may deschedule itself over quiescent cycles. */
+    const bool idleCycleSkip;
+
+    /** Binary pipeline trace written at commit, if one was asked for. */
+    std::unique_ptr<PipeTrace> pipeTrace;
+
+    /** Do the stages record the ticks each instruction passes them? */
+    bool recordStageTicks() const { return debug::O3PipeView || pipeTrace; }
+
+    /** Sampling profiler of the ROB head, if one was asked for. */
+    std::unique_ptr<HotspotProfiler> hotspotProfiler;
+
+    /** Sample the ROB head of every active thread. */
+    void sampleHotspots(unsigned samples);
+
+    /**
+     * Number of consecutive ticks the pipeline must stay quiescent with
+     * the same stall reasons before cycles are skipped. Waiting for the
+     * full depth of the time buffers makes every slot a stage reads
+     * hold what an extra tick would have written.
+     */
+    const unsigned quiescentThreshold;
+
+    /** Consecutive quiescent ticks seen so far. */
+    unsigned quiescentTicks = 0;
+
+    /** Stall reasons rename sent on the current and last quiescent tick. */
+    std::vector<StallReason> stallPattern;
+    std::vector<StallReason> lastStallPattern;
+
+    /** Is the CPU descheduled over quiescent cycles? */
+    bool idleSkipping = false;
+
+    /** Can every stage prove that its next tick only repeats stats? */
+    bool pipelineQuiescent();
+
+    /** Did rename send the same stall reasons as on the previous tick? */
+    bool stallPatternSteady();
+
+    /** Credits each stage with the cycles skipped while quiescent. */
+    void creditSkippedCycles();
+
     /** The cycle that the CPU was last activated by a new thread*/
     Tick lastActivatedCycle;
 
@@ -578,7 +624,7 @@ class CPU : public BaseCPU
     pushRequest(const DynInstPtr& inst, bool isLoad, uint8_t *data,
                 unsigned int size, Addr addr, Request::Flags flags,
                 uint64_t *res, AtomicOpFunctorPtr amo_op = nullptr,
-                const std::vector<bool>& byte_enable=std::vector<bool>())
+                const ByteEnable &byte_enable=ByteEnable())
 
     {
         return iew.ldstQueue.pushRequest(inst, isLoad, data, size, addr,
@@ -615,6 +661,9 @@ class CPU : public BaseCPU
         /** Stat for total number of cycles the CPU spends descheduled due to a
          * quiesce operation or waiting for an interrupt. */
         statistics::Scalar quiesceCycles;
+        /** Stat for total number of quiescent cycles skipped without
+         * ticking the pipeline. */
+        statistics::Scalar skippedCycles;
         /** Stat for the number of committed instructions per thread. */
         statistics::Vector committedInsts;
         /** Stat for the number of committed ops (including micro ops) per
@@ -613,6 +613,19 @@ Decode::tick()
     }
 }
 
+bool
+Decode::isQuiescent() const
+{
+    return numThreads == 1 && decodeStatus[0] == Blocked &&
+        stalls[0].rename && fromFetch->size == 0;
+}
+
+void
+Decode::creditQuiescentCycles(Cycles cycles)
+{
+    stats.blockedCycles += cycles;
+}
+
 void
 Decode::decode(bool &status_change, ThreadID tid)
 {
@@ -765,7 +778,7 @@ Decode::decodeInsts(ThreadID tid)
         --insts_available;
 
 #if TRACING_ON
-        if (debug::O3PipeView) {
+        if (cpu->recordStageTicks()) {
             inst->decodeTick = curTick() - inst->fetchTick;
             DPRINTF(O3PipeView, "Record decode for inst sn:%lu\n",
                     inst->seqNum);
@@ -137,6 +137,14 @@ class Decode
      */
     void tick();
 
+    /** Is decode blocked with nothing arriving from fetch, so that a tick
+     * would only repeat its stall accounting?
+     */
+    bool isQuiescent() const;
+
+    /** Credits the stall accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
+
     /** Determines what to do based on decode's current status.
      * @param status_change decode() sets this variable if there was a status
      * change (ie switching from from blocking to unblocking).
@@ -436,7 +436,7 @@ DynInst::trap(const Fault &fault)
 
 Fault
 DynInst::initiateMemRead(Addr addr, unsigned size, Request::Flags flags,
-                               const std::vector<bool> &byte_enable)
+                               const ByteEnable &byte_enable)
 {
     assert(byte_enable.size() == size);
     return cpu->pushRequest(
@@ -452,13 +452,13 @@ DynInst::initiateMemMgmtCmd(Request::Flags flags)
     return cpu->pushRequest(
             dynamic_cast<DynInstPtr::PtrType>(this),
             /* ld */ true, nullptr, size, 0x0ul, flags, nullptr, nullptr,
-            std::vector<bool>(size, true));
+            ByteEnable(size, true));
 }
 
 Fault
 DynInst::writeMem(uint8_t *data, unsigned size, Addr addr,
                         Request::Flags flags, uint64_t *res,
-                        const std::vector<bool> &byte_enable)
+                        const ByteEnable &byte_enable)
 {
     assert(byte_enable.size() == size);
     return cpu->pushRequest(
@@ -479,7 +479,7 @@ DynInst::initiateMemAMO(Addr addr, unsigned size, Request::Flags flags,
     return cpu->pushRequest(
             dynamic_cast<DynInstPtr::PtrType>(this),
             /* atomic */ false, nullptr, size, addr, flags, nullptr,
-            std::move(amo_op), std::vector<bool>(size, true));
+            std::move(amo_op), ByteEnable(size, true));
 }
 void
 DynInst::printDisassemblyAndResult(const std::string &site) const
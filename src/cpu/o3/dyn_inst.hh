@@ -438,13 +438,13 @@ class DynInst : public ExecContext, public RefCounted
     }
 
     Fault initiateMemRead(Addr addr, unsigned size, Request::Flags flags,
-            const std::vector<bool> &byte_enable) override;
+            const ByteEnable &byte_enable) override;
 
     Fault initiateMemMgmtCmd(Request::Flags flags) override;
 
     Fault writeMem(uint8_t *data, unsigned size, Addr addr,
                    Request::Flags flags, uint64_t *res,
-                   const std::vector<bool> &byte_enable) override;
+                   const ByteEnable &byte_enable) override;
 
     Fault initiateMemAMO(Addr addr, unsigned size, Request::Flags flags,
                          AtomicOpFunctorPtr amo_op) override;
@@ -1120,6 +1120,10 @@ class DynInst : public ExecContext, public RefCounted
     int32_t completeTick = -1;
     int32_t commitTick = -1;
     int32_t storeTick = -1;
+
+    /** Last StallReason other than NoStall blamed on this instruction
+     * while it was at the ROB head. */
+    uint8_t robHeadStall = 0;
 #endif
 
     /* Values used by LoadToUse stat */
@@ -1030,6 +1030,16 @@ Fetch::flushFetchBuffer()
     }
 }
 
+FtqState
+Fetch::ftqState() const
+{
+    if (!dbpftb)
+        return FtqState::None;
+    if (dbpftb->ftqEmpty())
+        return FtqState::Empty;
+    return dbpftb->ftqFull() ? FtqState::Full : FtqState::Partial;
+}
+
 Addr
 Fetch::getPreservedReturnAddr(const DynInstPtr &dynInst)
 {
@@ -1265,6 +1275,46 @@ Fetch::tick()
     }
 }
 
+bool
+Fetch::isQuiescent()
+{
+    if (numThreads != 1 || activeThreads->size() != 1 || !isFTBPred())
+        return false;
+
+    const ThreadID tid = 0;
+    if (fetchStatus[tid] != Running || !stalls[tid].decode ||
+        fetchQueue[tid].size() < fetchQueueSize || interruptPending ||
+        issuePipelinedIfetch[tid] || currentFetchTargetInLoop ||
+        macroop[tid] || ftqEmpty() || !dbpftb->fetchTargetAvailable()) {
+        return false;
+    }
+
+    // Running past the buffered block would start an icache access.
+    const PCStateBase &this_pc = *pc[tid];
+    Addr fetch_addr = (this_pc.instAddr() + fetchOffset[tid]) &
+        decoder[tid]->pcMask();
+    if (!fetchBufferValid[tid] || fetchBufferPC[tid] > fetch_addr ||
+        fetchBufferPC[tid] + fetchBufferSize <= fetch_addr) {
+        return false;
+    }
+
+    return dbpftb->isQuiescent();
+}
+
+void
+Fetch::creditQuiescentCycles(Cycles cycles)
+{
+    fetchStats.cycles += cycles;
+    fetchStats.nisnDist.sample(0, cycles);
+
+    // Keep the shared random stream where the per-tick thread pick
+    // would have left it.
+    for (Cycles i(0); i < cycles; ++i)
+        random_mt.random<uint8_t>(0, activeThreads->size() - 1);
+
+    dbpftb->creditQuiescentCycles(cycles);
+}
+
 bool
 Fetch::checkSignalsAndUpdate(ThreadID tid)
 {
@@ -1803,7 +1853,7 @@ Fetch::fetch(bool &status_change)
             numInst++;
 
 #if TRACING_ON
-            if (debug::O3PipeView) {
+            if (cpu->recordStageTicks()) {
                 instruction->fetchTick = curTick();
                 DPRINTF(O3PipeView, "Record fetch for inst sn:%lu\n",
                         instruction->seqNum);
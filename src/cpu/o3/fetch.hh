@@ -266,6 +266,16 @@ class Fetch
 
     /** For priority-based fetch policies, need to keep update priorityList */
     void deactivateThread(ThreadID tid);
+
+    /**
+     * Is fetch stalled on a full fetch queue behind a blocked decode, with
+     * the current fetch target already supplied and buffered? A tick then
+     * only repeats the same stall accounting and BPU bookkeeping.
+     */
+    bool isQuiescent();
+
+    /** Credits the per-cycle accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
   private:
     /** Reset this pipeline stage */
     void resetStage();
@@ -367,6 +377,9 @@ class Fetch
 
     branch_prediction::BPredUnit * getBp() { return branchPred; }
 
+    /** How full the fetch target queue is, for the hotspot profiler. */
+    FtqState ftqState() const;
+
     void flushFetchBuffer();
 
     Addr getPreservedReturnAddr(const DynInstPtr &dynInst);
@@ -433,7 +446,7 @@ class Fetch
     
     branch_prediction::stream_pred::DecoupledStreamBPU *dbsp;
 
-    branch_prediction::ftb_pred::DecoupledBPUWithFTB *dbpftb;
+    branch_prediction::ftb_pred::DecoupledBPUWithFTB *dbpftb = nullptr;
 
     std::unique_ptr<PCStateBase> pc[MaxThreads];
 
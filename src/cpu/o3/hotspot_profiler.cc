@@ -0,0 +1,217 @@
+#include "cpu/o3/hotspot_profiler.hh"
+
+#include <ostream>
+#include <unordered_map>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/statistics.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+namespace
+{
+
+/** Just enough of the protobuf wire format to write a profile.proto. */
+class Message
+{
+  public:
+    void
+    varint(int field, uint64_t value)
+    {
+        putVarint(field << 3);
+        putVarint(value);
+    }
+
+    void
+    bytes(int field, const std::string &value)
+    {
+        putVarint(field << 3 | 2);
+        putVarint(value.size());
+        buf.append(value);
+    }
+
+    void message(int field, const Message &msg) { bytes(field, msg.buf); }
+
+    const std::string &data() const { return buf; }
+
+  private:
+    void
+    putVarint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            buf.push_back(char(value | 0x80));
+            value >>= 7;
+        }
+        buf.push_back(char(value));
+    }
+
+    std::string buf;
+};
+
+/** Field numbers of profile.proto. */
+enum ProfileField
+{
+    SampleType = 1,
+    Sample = 2,
+    Location = 4,
+    Function = 5,
+    StringTable = 6,
+    PeriodType = 11,
+    Period = 12,
+    DefaultSampleType = 14
+};
+
+} // anonymous namespace
+
+HotspotProfiler::HotspotProfiler(const std::string &file_name,
+                                 Cycles _interval)
+    : fileName(file_name), interval(_interval), table(1024)
+{
+    fatal_if(interval == 0, "The hotspot profile interval must not be 0.\n");
+
+    statistics::registerDumpCallback([this]() { dump(); });
+    statistics::registerResetCallback([this]() { clear(); });
+}
+
+size_t
+HotspotProfiler::hash(Addr pc, StallReason reason, FtqState ftq)
+{
+    uint64_t key = pc ^ (uint64_t(reason) << 56) ^ (uint64_t(ftq) << 62);
+    return (key * 0x9e3779b97f4a7c15ULL) >> 32;
+}
+
+void
+HotspotProfiler::sample(Addr pc, StallReason reason, FtqState ftq,
+                        unsigned samples)
+{
+    const size_t mask = table.size() - 1;
+    for (size_t i = hash(pc, reason, ftq) & mask; ; i = (i + 1) & mask) {
+        Entry &entry = table[i];
+        if (entry.count == 0) {
+            entry = {pc, samples, reason, ftq};
+            if (++used * 2 > table.size())
+                grow();
+            return;
+        }
+        if (entry.pc == pc && entry.reason == reason && entry.ftq == ftq) {
+            entry.count += samples;
+            return;
+        }
+    }
+}
+
+void
+HotspotProfiler::grow()
+{
+    std::vector<Entry> old(table.size() * 2);
+    old.swap(table);
+
+    const size_t mask = table.size() - 1;
+    for (const Entry &entry : old) {
+        if (entry.count == 0)
+            continue;
+        size_t i = hash(entry.pc, entry.reason, entry.ftq) & mask;
+        while (table[i].count != 0)
+            i = (i + 1) & mask;
+        table[i] = entry;
+    }
+}
+
+void
+HotspotProfiler::clear()
+{
+    std::fill(table.begin(), table.end(), Entry{});
+    used = 0;
+}
+
+void
+HotspotProfiler::dump() const
+{
+    Message profile;
+
+    std::unordered_map<std::string, int64_t> strings;
+    auto string_id = [&](const std::string &str) -> int64_t {
+        auto [it, added] = strings.emplace(str, strings.size());
+        if (added)
+            profile.bytes(StringTable, str);
+        return it->second;
+    };
+    string_id("");
+
+    auto value_type = [&](int field, const char *type, const char *unit) {
+        Message msg;
+        msg.varint(1, string_id(type));
+        msg.varint(2, string_id(unit));
+        profile.message(field, msg);
+    };
+    value_type(SampleType, "samples", "count");
+    value_type(SampleType, "cycles", "count");
+    value_type(PeriodType, "cycles", "count");
+    profile.varint(Period, interval);
+    profile.varint(DefaultSampleType, string_id("cycles"));
+
+    // The stall reasons, and the empty ROB, are functions with one
+    // location each, numbered from 1. Locations of PCs follow.
+    const uint64_t rob_empty_id = NumStallReasons + 1;
+    auto function = [&](uint64_t id, const std::string &name) {
+        Message func;
+        func.varint(1, id);
+        func.varint(2, string_id(name));
+        profile.message(Function, func);
+
+        Message line;
+        line.varint(1, id);
+        Message loc;
+        loc.varint(1, id);
+        loc.message(4, line);
+        profile.message(Location, loc);
+    };
+    for (int reason = 0; reason < NumStallReasons; reason++)
+        function(reason + 1, stallReasonName(StallReason(reason)));
+    function(rob_empty_id, "[rob empty]");
+
+    std::unordered_map<Addr, uint64_t> pc_locations;
+    const int64_t ftq_key = string_id("ftq");
+    for (const Entry &entry : table) {
+        if (entry.count == 0)
+            continue;
+
+        uint64_t leaf = rob_empty_id;
+        if (entry.pc != 0) {
+            auto [it, added] = pc_locations.emplace(
+                entry.pc, rob_empty_id + 1 + pc_locations.size());
+            if (added) {
+                Message loc;
+                loc.varint(1, it->second);
+                loc.varint(3, entry.pc);
+                profile.message(Location, loc);
+            }
+            leaf = it->second;
+        }
+
+        Message label;
+        label.varint(1, ftq_key);
+        label.varint(2, string_id(ftqStateName(entry.ftq)));
+
+        Message sample;
+        sample.varint(1, leaf);
+        sample.varint(1, entry.reason + 1);
+        sample.varint(2, entry.count);
+        sample.varint(2, entry.count * interval);
+        sample.message(3, label);
+        profile.message(Sample, sample);
+    }
+
+    OutputStream *stream = simout.create(fileName, true);
+    fatal_if(!stream, "Can't create hotspot profile %s.\n", fileName);
+    stream->stream()->write(profile.data().data(), profile.data().size());
+    simout.close(stream);
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * Sampling profiler attributing O3 CPU cycles to the guest PCs at the
+ * ROB head and the reasons they stall. Every interval cycles the ROB
+ * head is counted in a (pc, stall reason, FTQ state) histogram, which
+ * is written as a pprof profile (profile.proto, gzip compressed when
+ * the file name ends in .gz) at every stats dump, replacing the one of
+ * the previous dump, and cleared at every stats reset.
+ *
+ * Every sample is a two frame stack, the stall reason calling the PC,
+ * so `pprof -top -addresses` lists the hot PCs and a flame graph splits
+ * the time of each reason by PC. The FTQ state is the "ftq" label of a
+ * sample (`pprof -tags`). Samples taken with an empty ROB have the frame
+ * "[rob empty]" instead of a PC. PCs are left unsymbolized, to be
+ * resolved offline against the guest binary.
+ */
+
+#ifndef __CPU_O3_HOTSPOT_PROFILER_HH__
+#define __CPU_O3_HOTSPOT_PROFILER_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/o3/comm.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+class HotspotProfiler
+{
+  public:
+    /** Write to file_name in the output directory. */
+    HotspotProfiler(const std::string &file_name, Cycles interval);
+
+    /** Count a cycle and return the number of samples due now. */
+    unsigned
+    tick()
+    {
+        if (++elapsed < interval)
+            return 0;
+        unsigned samples = elapsed / interval;
+        elapsed %= interval;
+        return samples;
+    }
+
+    /**
+     * Count cycles the CPU skipped without ticking, they are sampled at
+     * its next tick.
+     */
+    void skip(Cycles cycles) { elapsed += cycles; }
+
+    /** Count samples of the ROB head; pc is 0 if the ROB is empty. */
+    void sample(Addr pc, StallReason reason, FtqState ftq,
+                unsigned samples);
+
+    /** Write the profile of the samples since the last reset. */
+    void dump() const;
+
+    /** Drop all samples. */
+    void clear();
+
+  private:
+    /**
+     * A slot of the open addressing histogram, free while its count is
+     * zero.
+     */
+    struct Entry
+    {
+        Addr pc;
+        uint64_t count;
+        StallReason reason;
+        FtqState ftq;
+    };
+
+    static size_t hash(Addr pc, StallReason reason, FtqState ftq);
+
+    /** Double the table once it is half full. */
+    void grow();
+
+    const std::string fileName;
+    const uint64_t interval;
+
+    /** Cycles since the last sample. */
+    uint64_t elapsed = 0;
+
+    std::vector<Entry> table;
+    size_t used = 0;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_HOTSPOT_PROFILER_HH__
@@ -267,53 +267,12 @@ IEW::IEWStats::IEWStats(CPU *cpu)
             .init(NumStallReasons)
             .flags(statistics::total);
 
-    std::map <StallReason, const char*> stallReasonStr = {
-        {StallReason::NoStall, "NoStall"},
-        {StallReason::IcacheStall, "IcacheStall"},
-        {StallReason::ITlbStall, "ITlbStall"},
-        {StallReason::DTlbStall, "DTlbStall"},
-        {StallReason::BpStall, "BpStall"},
-        {StallReason::IntStall, "IntStall"},
-        {StallReason::TrapStall, "TrapStall"},
-        {StallReason::FragStall, "FragStall"},
-        {StallReason::SquashStall, "SquashStall"},
-        {StallReason::FetchBufferInvalid, "FetchBufferInvalid"},
-        {StallReason::InstMisPred, "InstMisPred"},
-        {StallReason::InstSquashed, "InstSquashed"},
-        {StallReason::SerializeStall, "SerializeStall"},
-        {StallReason::VectorLongExecute, "VectorLongExecute"},
-        {StallReason::ScalarLongExecute, "ScalarLongExecute"},
-        {StallReason::InstNotReady, "InstNotReady"},
-        {StallReason::LoadL1Bound, "LoadL1Bound"},
-        {StallReason::LoadL2Bound, "LoadL2Bound"},
-        {StallReason::LoadL3Bound, "LoadL3Bound"},
-        {StallReason::LoadMemBound, "LoadMemBound"},
-        {StallReason::StoreL1Bound, "StoreL1Bound"},
-        {StallReason::StoreL2Bound, "StoreL2Bound"},
-        {StallReason::StoreL3Bound, "StoreL3Bound"},
-        {StallReason::StoreMemBound, "StoreMemBound"},
-        {StallReason::MemSquashed, "MemSquashed"},
-        {StallReason::Atomic,"Atomic"},
-        {StallReason::ResumeUnblock, "ResumeUnblock"},
-        {StallReason::CommitSquash, "CommitSquash"},
-        {StallReason::OtherStall, "OtherStall"},
-        {StallReason::OtherFetchStall, "OtherFetchStall"},
-
-        {StallReason::MemDQBandwidth, "MemDQBandwidth"},
-        {StallReason::FVDQBandwidth, "FVDQBandwidth"},
-        {StallReason::IntDQBandwidth, "IntDQBandwidth"},
-        {StallReason::MemNotReady, "MemNotReady"},
-        {StallReason::MemCommitRateLimit, "MemCommitRateLimit"},
-        {StallReason::OtherMemStall, "OtherMemStall"},
-        {StallReason::VectorReadyButNotIssued, "VectorReadyButNotIssued"},
-        {StallReason::ScalarReadyButNotIssued, "ScalarReadyButNotIssued"}
-    };
-
     for (int i = 0;i < NumStallReasons;i++) {
-        fetchStallReason.subname(i, stallReasonStr[static_cast<StallReason>(i)]);
-        decodeStallReason.subname(i, stallReasonStr[static_cast<StallReason>(i)]);
-        renameStallReason.subname(i, stallReasonStr[static_cast<StallReason>(i)]);
-        dispatchStallReason.subname(i, stallReasonStr[static_cast<StallReason>(i)]);
+        const char *name = stallReasonName(static_cast<StallReason>(i));
+        fetchStallReason.subname(i, name);
+        decodeStallReason.subname(i, name);
+        renameStallReason.subname(i, name);
+        dispatchStallReason.subname(i, name);
     }
 }
 
@@ -1128,7 +1087,8 @@ IEW::classifyInstToDispQue(ThreadID tid)
     }
 
     if (insts_to_add == 0) {
-        dispatchStalls = fromRename->renameStallReason;
+        dispatchStalls.assign(fromRename->renameStallReason.begin(),
+                              fromRename->renameStallReason.end());
     } else {
         for (int i = 0; i < renameWidth; i++) {
             if (i < dispatched) {
@@ -1689,6 +1649,13 @@ IEW::tick()
         dispatch(tid);
 
         toRename->iewInfo[tid].robHeadStallReason = checkDispatchStall(tid, NumDQ, nullptr);
+#if TRACING_ON
+        if (cpu->pipeTrace && !rob->isEmpty(tid) &&
+            toRename->iewInfo[tid].robHeadStallReason != NoStall) {
+            rob->readHeadInst(tid)->robHeadStall =
+                toRename->iewInfo[tid].robHeadStallReason;
+        }
+#endif
         toRename->iewInfo[tid].lqHeadStallReason =
             ldstQueue.lqEmpty() ? StallReason::NoStall : checkLSQStall(tid, true);
         toRename->iewInfo[tid].sqHeadStallReason =
@@ -1788,6 +1755,50 @@ IEW::tick()
     }
 }
 
+bool
+IEW::isQuiescent()
+{
+    if (numThreads != 1 ||
+        (dispatchStatus[0] != Running && dispatchStatus[0] != Idle) ||
+        exeStatus != Idle || updateLSQNextCycle || wroteToTimeBuffer) {
+        return false;
+    }
+
+    if (fromRename->size || !insts[0].empty() || fromIssue->size ||
+        execWB->insts[0]) {
+        return false;
+    }
+
+    for (const auto &dq : dispQue) {
+        if (!dq.empty())
+            return false;
+    }
+
+    return instQueue.isQuiescent() && scheduler->isQuiescent() &&
+        ldstQueue.isQuiescent();
+}
+
+void
+IEW::creditQuiescentCycles(Cycles cycles)
+{
+    for (auto reason : fromRename->fetchStallReason) {
+        iewStats.fetchStallReason[reason] += cycles;
+    }
+    for (auto reason : fromRename->decodeStallReason) {
+        iewStats.decodeStallReason[reason] += cycles;
+    }
+    for (auto reason : fromRename->renameStallReason) {
+        iewStats.renameStallReason[reason] += cycles;
+    }
+    for (auto reason : dispatchStalls) {
+        iewStats.dispatchStallReason[reason] += cycles;
+    }
+
+    iewStats.dispDist.sample(0, cycles);
+    scheduler->creditQuiescentCycles(cycles);
+    instQueue.creditQuiescentCycles(cycles);
+}
+
 void
 IEW::updateExeInstStats(const DynInstPtr& inst)
 {
@@ -1796,7 +1807,7 @@ IEW::updateExeInstStats(const DynInstPtr& inst)
     iewStats.executedInstStats.numInsts++;
 
 #if TRACING_ON
-    if (debug::O3PipeView) {
+    if (cpu->recordStageTicks()) {
         inst->completeTick = curTick() - inst->fetchTick;
     }
 #endif
@@ -331,6 +331,19 @@ class IEW
      */
     void tick();
 
+    /**
+     * Is IEW idle apart from waiting on outstanding memory or FU work?
+     * Nothing may be arriving from rename, waiting in the dispatch queues,
+     * ready to issue, executing or writing back, and the store path must
+     * have nothing to send.
+     */
+    bool isQuiescent();
+
+    /** Credits the topdown and per-cycle accounting of cycles skipped
+     * while quiescent.
+     */
+    void creditQuiescentCycles(Cycles cycles);
+
   private:
     /** Updates execution stats based on the instruction. */
     void updateExeInstStats(const DynInstPtr &inst);
@@ -629,6 +629,19 @@ InstructionQueue::scheduleReadyInsts()
     }
 }
 
+bool
+InstructionQueue::isQuiescent() const
+{
+    return instsToExecute.empty() && deferredMemInsts.empty() &&
+        retryMemInsts.empty();
+}
+
+void
+InstructionQueue::creditQuiescentCycles(Cycles cycles)
+{
+    iqStats.numIssuedDist.sample(0, cycles);
+}
+
 void
 InstructionQueue::notifyExecuted(const DynInstPtr &inst)
 {
@@ -214,6 +214,14 @@ class InstructionQueue
      */
     void scheduleReadyInsts();
 
+    /** Is there nothing to execute or replay? Insts blocked on the cache
+     * are only retried after the cache unblocks, which wakes the CPU.
+     */
+    bool isQuiescent() const;
+
+    /** Credits the issue accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
+
     /** Schedules a single specific non-speculative instruction. */
     void scheduleNonSpec(const InstSeqNum &inst);
 
@@ -287,6 +287,20 @@ IssueQue::tick()
     inflightIssues.advance();
 }
 
+bool
+IssueQue::isQuiescent()
+{
+    if (instNumInsert || !readyInsts.empty() || !selectedInst.empty()) {
+        return false;
+    }
+    for (int i = 0; i <= scheduleToExecDelay; i++) {
+        if (inflightIssues[-i].size) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool
 IssueQue::ready()
 {
@@ -423,6 +437,7 @@ Scheduler::SpecWakeupCompletion::SpecWakeupCompletion(const DynInstPtr& inst, Is
 void
 Scheduler::SpecWakeupCompletion::process()
 {
+    to_issue_queue->scheduler->specWakeupsInFlight--;
     to_issue_queue->wakeUpDependents(inst, true);
 }
 
@@ -531,6 +546,29 @@ Scheduler::tick()
     }
 }
 
+bool
+Scheduler::isQuiescent()
+{
+    if (!instsToFu.empty() || specWakeupsInFlight) {
+        return false;
+    }
+    for (auto it : issueQues) {
+        if (!it->isQuiescent()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+Scheduler::creditQuiescentCycles(Cycles cycles)
+{
+    for (auto it : issueQues) {
+        it->iqstats->insertDist[0] += cycles;
+        it->iqstats->issueDist[0] += cycles;
+    }
+}
+
 void
 Scheduler::issueAndSelect(){
     for (auto it : issueQues) {
@@ -678,6 +716,7 @@ Scheduler::wakeUpDependents(const DynInstPtr& inst, IssueQue* from_issue_queue)
         } else {
             auto wakeEvent = new SpecWakeupCompletion(inst, to);
             cpu->schedule(wakeEvent, cpu->clockEdge(Cycles(wakeDelay)) - 1);
+            specWakeupsInFlight++;
         }
     }
 }
@@ -810,6 +849,20 @@ Scheduler::getCorrectedOpLat(const DynInstPtr& inst)
     return oplat;
 }
 
+void
+Scheduler::setOpLatency(const std::string &op_class, uint32_t latency)
+{
+    fatal_if(latency == 0, "%s: %s needs a latency of at least 1.\n",
+             name(), op_class);
+    for (int op = 0; op < enums::OpClass::Num_OpClass; op++) {
+        if (op_class == enums::OpClassStrings[op]) {
+            opExecTimeTable[op] = latency;
+            return;
+        }
+    }
+    fatal("%s: unknown op class %s.\n", name(), op_class);
+}
+
 bool
 Scheduler::hasReadyInsts()
 {
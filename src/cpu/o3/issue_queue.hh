@@ -99,14 +99,14 @@ class IssueQue : public SimObject
     struct IssueQueStats : public statistics::Group
     {
         IssueQueStats(statistics::Group* parent, IssueQue* que, std::string name);
-        statistics::Scalar full;
-        statistics::Scalar bwfull;
-        statistics::Scalar retryMem;
-        statistics::Scalar canceledInst;
-        statistics::Scalar loadmiss;
-        statistics::Scalar arbFailed;
-        statistics::Vector insertDist;
-        statistics::Vector issueDist;
+        statistics::BankedScalar full;
+        statistics::BankedScalar bwfull;
+        statistics::BankedScalar retryMem;
+        statistics::BankedScalar canceledInst;
+        statistics::BankedScalar loadmiss;
+        statistics::BankedScalar arbFailed;
+        statistics::BankedVector insertDist;
+        statistics::BankedVector issueDist;
     } *iqstats = nullptr;
 
     void replay(const DynInstPtr& inst);
@@ -125,6 +125,7 @@ class IssueQue : public SimObject
     void resetDepGraph(int numPhysRegs);
 
     void tick();
+    bool isQuiescent();
     bool full();
     bool ready();
     void insert(const DynInstPtr& inst);
@@ -180,6 +181,9 @@ class Scheduler : public SimObject
 
     std::vector<DynInstPtr> instsToFu;
 
+    // speculative wakeups scheduled but not yet delivered
+    unsigned specWakeupsInFlight = 0;
+
     std::vector<bool> bypassScoreboard;
     std::vector<bool> scoreboard;
 
@@ -215,6 +219,8 @@ class Scheduler : public SimObject
     void setMemDepUnit(MemDepUnit *memDepUnit) { this->memDepUnit = memDepUnit; }
 
     void tick();
+    bool isQuiescent();
+    void creditQuiescentCycles(Cycles cycles);
     void issueAndSelect();
     bool full(const DynInstPtr& inst);
     bool ready(const DynInstPtr& inst);
@@ -237,6 +243,9 @@ class Scheduler : public SimObject
     uint32_t getArbPriority(const DynInstPtr& inst);
     uint32_t getOpLatency(const DynInstPtr& inst);
     uint32_t getCorrectedOpLat(const DynInstPtr& inst);
+    // change the execution latency of an op class (given by name) at runtime,
+    // e.g. in a child of a fork sweep
+    void setOpLatency(const std::string &op_class, uint32_t latency);
     bool hasReadyInsts();
     bool isDrained();
     void doCommit(const InstSeqNum seqNum);
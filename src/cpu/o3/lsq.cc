@@ -189,6 +189,19 @@ LSQ::tick()
     usedLoadPorts = 0;
     usedStorePorts = 0;
 }
+bool
+LSQ::isQuiescent()
+{
+    if (usedLoadPorts || usedStorePorts)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (!thread[tid].storesQuiescent())
+            return false;
+    }
+    return true;
+}
+
 Tick
 LSQ::getLastConflictCheckTick()
 {
@@ -855,7 +868,7 @@ LSQ::dumpInsts(ThreadID tid) const
 Fault
 LSQ::pushRequest(const DynInstPtr& inst, bool isLoad, uint8_t *data,
         unsigned int size, Addr addr, Request::Flags flags, uint64_t *res,
-        AtomicOpFunctorPtr amo_op, const std::vector<bool>& byte_enable)
+        AtomicOpFunctorPtr amo_op, const ByteEnable &byte_enable)
 {
     // This comming request can be either load, store or atomic.
     // Atomic request has a corresponding pointer to its atomic memory
@@ -1082,29 +1095,23 @@ LSQ::SplitDataRequest::initiateTranslation()
     _mainReq->setPaddr(0);
 
     /* Get the pre-fix, possibly unaligned. */
-    auto it_start = _byteEnable.begin();
-    auto it_end = _byteEnable.begin() + (next_addr - base_addr);
     addReq(base_addr, next_addr - base_addr,
-                     std::vector<bool>(it_start, it_end));
+           _byteEnable.slice(0, next_addr - base_addr));
     size_so_far = next_addr - base_addr;
 
     /* We are block aligned now, reading whole blocks. */
     base_addr = next_addr;
     while (base_addr != final_addr) {
-        auto it_start = _byteEnable.begin() + size_so_far;
-        auto it_end = _byteEnable.begin() + size_so_far + cacheLineSize;
         addReq(base_addr, cacheLineSize,
-                         std::vector<bool>(it_start, it_end));
+               _byteEnable.slice(size_so_far, cacheLineSize));
         size_so_far += cacheLineSize;
         base_addr += cacheLineSize;
     }
 
     /* Deal with the tail. */
     if (size_so_far < _size) {
-        auto it_start = _byteEnable.begin() + size_so_far;
-        auto it_end = _byteEnable.end();
         addReq(base_addr, _size - size_so_far,
-                         std::vector<bool>(it_start, it_end));
+               _byteEnable.slice(size_so_far, _size - size_so_far));
     }
 
     if (_reqs.size() > 0) {
@@ -1137,7 +1144,8 @@ LSQ::SbufferRequest::SbufferRequest(CPU* cpu, LSQUnit* port, Addr blockpaddr, ui
       cpu(cpu) {}
 
 void
-LSQ::SbufferRequest::addReq(Addr blockVaddr, Addr blockPaddr, const std::vector<bool> byteEnable)
+LSQ::SbufferRequest::addReq(Addr blockVaddr, Addr blockPaddr,
+                            const ByteEnable &byteEnable)
 {
     auto req = std::make_shared<Request>(
         blockPaddr, _port.cacheLineSize(), Request::Flags(),
@@ -1210,9 +1218,9 @@ bool LSQ::LSQRequest::squashed() const { return _inst->isSquashed(); }
 
 void
 LSQ::LSQRequest::addReq(Addr addr, unsigned size,
-           const std::vector<bool>& byte_enable)
+           const ByteEnable &byte_enable)
 {
-    if (isAnyActiveElement(byte_enable.begin(), byte_enable.end())) {
+    if (byte_enable.any()) {
         auto req = std::make_shared<Request>(
                 addr, size, _flags, _inst->requestorId(),
                 _inst->pcState().instAddr(), _inst->contextId(),
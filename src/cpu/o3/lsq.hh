@@ -258,7 +258,7 @@ class LSQ
         const Addr _addr;
         const uint32_t _size;
         const Request::Flags _flags;
-        std::vector<bool> _byteEnable;
+        ByteEnable _byteEnable;
         uint32_t _numOutstandingPackets;
         AtomicOpFunctorPtr _amo_op;
         bool _hasStaleTranslation;
@@ -331,7 +331,7 @@ class LSQ
          * element in the mask.
          */
         void addReq(Addr addr, unsigned size,
-                const std::vector<bool>& byte_enable);
+                const ByteEnable &byte_enable);
 
         void forward();
 
@@ -694,7 +694,8 @@ class LSQ
         uint64_t sbuffer_index=-1;
         SbufferRequest(CPU* cpu, LSQUnit* port, Addr blockpaddr, uint8_t* data);
 
-        void addReq(Addr blockVaddr, Addr blockPaddr, const std::vector<bool> byteEnable);
+        void addReq(Addr blockVaddr, Addr blockPaddr,
+                    const ByteEnable &byteEnable);
 
         // do not translate
         void markAsStaleTranslation() override {}
@@ -733,6 +734,11 @@ class LSQ
     /** Ticks the LSQ. */
     void tick();
 
+    /** Would the LSQ neither use a cache port nor move a store on the
+     * next cycle?
+     */
+    bool isQuiescent();
+
     /** Inserts a load into the LSQ. */
     void insertLoad(const DynInstPtr &load_inst);
     /** Inserts a store into the LSQ. */
@@ -931,7 +937,7 @@ class LSQ
     Fault pushRequest(const DynInstPtr& inst, bool isLoad, uint8_t *data,
                       unsigned int size, Addr addr, Request::Flags flags,
                       uint64_t *res, AtomicOpFunctorPtr amo_op,
-                      const std::vector<bool>& byte_enable);
+                      const ByteEnable &byte_enable);
 
     /** The CPU pointer. */
     CPU *cpu;
@@ -0,0 +1,124 @@
+#include "cpu/o3/lsq_addr_index.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+LSQAddrIndex::LSQAddrIndex(size_t _capacity, unsigned granule_shift)
+    : capacity(_capacity), words((_capacity + 63) / 64),
+      granuleShift(granule_shift),
+      masks((numBuckets + 1) * words, 0),
+      slots(_capacity), scratch(words)
+{
+}
+
+void
+LSQAddrIndex::setGranuleShift(unsigned granule_shift)
+{
+    panic_if(std::any_of(slots.begin(), slots.end(),
+                         [](const Slot &slot) { return slot.filed; }),
+             "Changing the granule of a non-empty LSQ address index.");
+    granuleShift = granule_shift;
+}
+
+bool
+LSQAddrIndex::span(Addr addr, unsigned size, Addr &first, Addr &last) const
+{
+    first = addr >> granuleShift;
+    last = (addr + std::max(size, 1U) - 1) >> granuleShift;
+    // wrapping accesses are wide too
+    return last >= first && last - first < maxSpan;
+}
+
+void
+LSQAddrIndex::insert(size_t idx, Addr addr, unsigned size)
+{
+    remove(idx);
+
+    size_t s = idx % capacity;
+    Slot &slot = slots[s];
+    slot.filed = true;
+    slot.wide = !span(addr, size, slot.first, slot.last);
+
+    uint64_t bit = 1ULL << (s % 64);
+    if (slot.wide) {
+        mask(numBuckets)[s / 64] |= bit;
+        return;
+    }
+    for (Addr g = slot.first; g != slot.last + 1; g++)
+        mask(bucket(g))[s / 64] |= bit;
+}
+
+void
+LSQAddrIndex::remove(size_t idx)
+{
+    size_t s = idx % capacity;
+    Slot &slot = slots[s];
+    if (!slot.filed)
+        return;
+    slot.filed = false;
+
+    uint64_t bit = ~(1ULL << (s % 64));
+    if (slot.wide) {
+        mask(numBuckets)[s / 64] &= bit;
+        return;
+    }
+    for (Addr g = slot.first; g != slot.last + 1; g++)
+        mask(bucket(g))[s / 64] &= bit;
+}
+
+void
+LSQAddrIndex::candidates(Addr addr, unsigned size, size_t begin, size_t end,
+                         std::vector<size_t> &out) const
+{
+    out.clear();
+    if (begin >= end)
+        return;
+    assert(end - begin <= capacity);
+
+    // union of the masks the access could be filed under
+    std::vector<uint64_t> &found = scratch;
+    const uint64_t *wide = mask(numBuckets);
+    std::copy(wide, wide + words, found.begin());
+
+    Addr first, last;
+    if (span(addr, size, first, last)) {
+        for (Addr g = first; g != last + 1; g++) {
+            const uint64_t *m = mask(bucket(g));
+            for (size_t w = 0; w < words; w++)
+                found[w] |= m[w];
+        }
+    } else {
+        // a wide access may overlap anything that is filed
+        for (unsigned b = 0; b < numBuckets; b++) {
+            const uint64_t *m = mask(b);
+            for (size_t w = 0; w < words; w++)
+                found[w] |= m[w];
+        }
+    }
+
+    // walk the slots of [begin, end) in queue order, wrapping once
+    size_t begin_slot = begin % capacity;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t bits = found[w];
+        while (bits) {
+            size_t s = w * 64 + findLsbSet(bits);
+            bits &= bits - 1;
+            size_t idx = begin + (s + capacity - begin_slot) % capacity;
+            if (idx < end)
+                out.push_back(idx);
+        }
+    }
+    std::sort(out.begin(), out.end());
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * Address index over the entries of a load or store queue, so searches
+ * for entries overlapping an access only visit likely candidates instead
+ * of scanning the whole queue.
+ */
+
+#ifndef __CPU_O3_LSQ_ADDR_INDEX_HH__
+#define __CPU_O3_LSQ_ADDR_INDEX_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Hash from address granules to bitmasks of queue slots. An entry is
+ * filed under every granule its access touches, or under all of them if
+ * it touches more than maxSpan granules, so every entry overlapping an
+ * access is among the candidates returned for it. Candidates may also be
+ * entries that only share a hash bucket, callers check them exactly.
+ *
+ * Entries are named by their CircularQueue index, which only grows, so
+ * the slot of index idx is idx % capacity.
+ */
+class LSQAddrIndex
+{
+  public:
+    /**
+     * @param capacity Capacity of the queue.
+     * @param granule_shift log2 of the granule size; a search can match
+     * entries at a coarser granularity than bytes as long as it is not
+     * coarser than the granules.
+     */
+    LSQAddrIndex(size_t capacity, unsigned granule_shift);
+
+    void setGranuleShift(unsigned granule_shift);
+
+    /** File the entry at idx under [addr, addr + size). */
+    void insert(size_t idx, Addr addr, unsigned size);
+
+    /** Forget the entry at idx, if it was filed. */
+    void remove(size_t idx);
+
+    /**
+     * Put the indices in [begin, end) that may overlap [addr, addr + size)
+     * in out, oldest first.
+     */
+    void candidates(Addr addr, unsigned size, size_t begin, size_t end,
+                    std::vector<size_t> &out) const;
+
+  private:
+    static constexpr unsigned bucketBits = 6;
+    static constexpr unsigned numBuckets = 1 << bucketBits;
+    static constexpr unsigned maxSpan = 4;
+
+    unsigned
+    bucket(Addr granule) const
+    {
+        return (granule ^ (granule >> bucketBits)) & (numBuckets - 1);
+    }
+
+    uint64_t *
+    mask(unsigned bucket)
+    {
+        return &masks[bucket * words];
+    }
+
+    const uint64_t *
+    mask(unsigned bucket) const
+    {
+        return &masks[bucket * words];
+    }
+
+    /** Granules touched by an access; false if there are too many. */
+    bool span(Addr addr, unsigned size, Addr &first, Addr &last) const;
+
+    const size_t capacity;
+    const size_t words;
+    unsigned granuleShift;
+
+    /** numBuckets masks of words each, then the mask of wide entries. */
+    std::vector<uint64_t> masks;
+
+    struct Slot
+    {
+        bool filed = false;
+        bool wide = false;
+        Addr first = 0;
+        Addr last = 0;
+    };
+    std::vector<Slot> slots;
+
+    /** Union of masks built by candidates(). */
+    mutable std::vector<uint64_t> scratch;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_LSQ_ADDR_INDEX_HH__
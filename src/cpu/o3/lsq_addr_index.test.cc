@@ -0,0 +1,182 @@
+/**
+ * @file
+ * Candidates of the LSQ address index: every filed entry overlapping an
+ * access must be found, in queue order, as the indices of the queue grow
+ * and wrap around its slots.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "cpu/o3/lsq_addr_index.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+/** Two words of slot bits, the second one partly used. */
+const size_t capacity = 72;
+
+std::vector<size_t>
+candidates(const LSQAddrIndex &index, Addr addr, unsigned size,
+           size_t begin, size_t end)
+{
+    std::vector<size_t> out;
+    index.candidates(addr, size, begin, end, out);
+    return out;
+}
+
+} // anonymous namespace
+
+/** Entries are found by accesses overlapping them, until removed. */
+TEST(LSQAddrIndexTest, InsertRemove)
+{
+    LSQAddrIndex index(capacity, 3);
+    index.insert(0, 0x1000, 8);
+    index.insert(1, 0x2000, 4);
+    index.insert(2, 0x1004, 2);
+    index.insert(3, 0x1ff8, 16);
+
+    EXPECT_EQ(candidates(index, 0x1000, 8, 0, 4),
+              std::vector<size_t>({0, 2}));
+    EXPECT_EQ(candidates(index, 0x1006, 1, 0, 4),
+              std::vector<size_t>({0, 2}));
+    EXPECT_EQ(candidates(index, 0x2002, 1, 0, 4),
+              std::vector<size_t>({1, 3}));
+    EXPECT_EQ(candidates(index, 0x1ffc, 2, 0, 4),
+              std::vector<size_t>({3}));
+    EXPECT_TRUE(candidates(index, 0x3000, 8, 0, 4).empty());
+
+    // only [begin, end) is searched
+    EXPECT_EQ(candidates(index, 0x1000, 8, 1, 4),
+              std::vector<size_t>({2}));
+    EXPECT_TRUE(candidates(index, 0x1000, 8, 1, 2).empty());
+    EXPECT_TRUE(candidates(index, 0x1000, 8, 2, 2).empty());
+
+    index.remove(2);
+    EXPECT_EQ(candidates(index, 0x1000, 8, 0, 4),
+              std::vector<size_t>({0}));
+    // removing twice, or something never filed, is harmless
+    index.remove(2);
+    index.remove(10);
+    EXPECT_EQ(candidates(index, 0x1000, 8, 0, 4),
+              std::vector<size_t>({0}));
+
+    // filing an entry again moves it
+    index.insert(0, 0x2004, 4);
+    EXPECT_TRUE(candidates(index, 0x1000, 8, 0, 4).empty());
+    EXPECT_EQ(candidates(index, 0x2000, 8, 0, 4),
+              std::vector<size_t>({0, 1, 3}));
+}
+
+/**
+ * Entries and accesses spanning many granules overlap everything. The
+ * addresses here fall in different buckets, so there are no false hits.
+ */
+TEST(LSQAddrIndexTest, WideEntries)
+{
+    LSQAddrIndex index(capacity, 3);
+    index.insert(5, 0x1000, 8);
+    index.insert(6, 0x8000, 64);
+    index.insert(7, 0x9100, 8);
+
+    EXPECT_EQ(candidates(index, 0x1000, 8, 0, capacity),
+              std::vector<size_t>({5, 6}));
+    EXPECT_EQ(candidates(index, 0x4000, 64, 0, capacity),
+              std::vector<size_t>({5, 6, 7}));
+
+    // an access wrapping the address space is wide too
+    EXPECT_EQ(candidates(index, ~Addr(0) - 3, 8, 0, capacity),
+              std::vector<size_t>({5, 6, 7}));
+
+    index.remove(6);
+    EXPECT_EQ(candidates(index, 0x1000, 8, 0, capacity),
+              std::vector<size_t>({5}));
+}
+
+/**
+ * As the indices grow past the capacity, slots are reused and
+ * candidates come back in queue order across the wrap.
+ */
+TEST(LSQAddrIndexTest, IndicesWrapAround)
+{
+    LSQAddrIndex index(capacity, 4);
+    const size_t begin = 3 * capacity - 10;
+    const size_t end = begin + capacity;
+    for (size_t idx = begin; idx < end; idx++)
+        index.insert(idx, 0x4000 + (idx % 3) * 0x100, 8);
+
+    std::vector<size_t> expected;
+    for (size_t idx = begin; idx < end; idx++) {
+        if (idx % 3 == 1)
+            expected.push_back(idx);
+    }
+    EXPECT_EQ(candidates(index, 0x4100, 4, begin, end), expected);
+
+    // a window starting after the wrap
+    std::vector<size_t> tail;
+    for (size_t idx : expected) {
+        if (idx >= 3 * capacity)
+            tail.push_back(idx);
+    }
+    EXPECT_EQ(candidates(index, 0x4100, 4, 3 * capacity, end), tail);
+
+    // retire the oldest ten and refill their slots with the next indices
+    for (size_t idx = begin; idx < begin + 10; idx++)
+        index.remove(idx);
+    for (size_t idx = end; idx < end + 10; idx++)
+        index.insert(idx, 0x4100, 8);
+    std::vector<size_t> refilled(expected.begin() + 3, expected.end());
+    for (size_t idx = end; idx < end + 10; idx++)
+        refilled.push_back(idx);
+    EXPECT_EQ(candidates(index, 0x4100, 4, begin + 10, end + 10), refilled);
+}
+
+/**
+ * Random entries and accesses: the candidates include every overlapping
+ * entry of the window, in order, with no index outside it.
+ */
+TEST(LSQAddrIndexTest, FindsEveryOverlap)
+{
+    std::mt19937_64 rng(1);
+    LSQAddrIndex index(capacity, 3);
+    struct Entry { Addr addr; unsigned size; };
+    std::vector<Entry> entries(capacity);
+
+    size_t head = 0, tail = 0;
+    for (int step = 0; step < 20000; step++) {
+        if (tail - head < capacity && rng() % 2) {
+            Entry &e = entries[tail % capacity];
+            e.addr = 0x10000 + rng() % 0x400;
+            e.size = rng() % 8 ? 1 << (rng() % 4) : 1 + rng() % 100;
+            index.insert(tail++, e.addr, e.size);
+        } else if (head < tail) {
+            index.remove(head++);
+        }
+
+        const Addr addr = 0x10000 + rng() % 0x400;
+        const unsigned size = 1 << (rng() % 4);
+        const size_t begin = head + (head < tail ? rng() % (tail - head) : 0);
+        const std::vector<size_t> found =
+            candidates(index, addr, size, begin, tail);
+        ASSERT_TRUE(std::is_sorted(found.begin(), found.end()));
+
+        auto it = found.begin();
+        for (size_t idx = begin; idx < tail; idx++) {
+            const Entry &e = entries[idx % capacity];
+            while (it != found.end() && *it < idx)
+                it++;
+            if (e.addr < addr + size && addr < e.addr + e.size) {
+                ASSERT_TRUE(it != found.end() && *it == idx)
+                    << "missed " << idx << " at step " << step;
+            }
+        }
+        for (size_t idx : found)
+            ASSERT_TRUE(idx >= begin && idx < tail);
+    }
+}
@@ -117,10 +117,8 @@ LSQUnit::bankConflictReplayEvent::description() const
 void LSQUnit::StoreBufferEntry::reset(uint64_t block_vaddr, uint64_t block_paddr,
                                       uint64_t offset, uint8_t *datas,
                                       uint64_t size) {
-    std::fill(validMask.begin(), validMask.begin() + offset, false);
-    std::fill(validMask.begin() + offset, validMask.begin() + offset + size,
-                true);
-    std::fill(validMask.begin() + offset + size, validMask.end(), false);
+    validMask.resize(validMask.size());
+    validMask.set(offset, size, true);
     memcpy(blockDatas.data() + offset, datas, size);
 
     this->blockVaddr = block_vaddr;
@@ -133,10 +131,8 @@ void
 LSQUnit::StoreBufferEntry::merge(uint64_t offset, uint8_t* datas, uint64_t size)
 {
     assert(offset + size <= validMask.size());
-    for (uint64_t i = 0; i < size; ++i) {
-        blockDatas[offset + i] = datas[i];
-        validMask[offset + i] = true;
-    }
+    memcpy(blockDatas.data() + offset, datas, size);
+    validMask.set(offset, size, true);
 }
 
 
@@ -300,6 +296,8 @@ LSQUnit::LSQUnit(uint32_t lqEntries, uint32_t sqEntries, uint32_t sbufferEntries
       lsqID(-1),
       storeQueue(sqEntries),
       loadQueue(lqEntries),
+      loadAddrIndex(loadQueue.capacity(), 0),
+      storeAddrIndex(storeQueue.capacity(), 0),
       storesToWB(0),
       htmStarts(0),
       htmStops(0),
@@ -331,6 +329,10 @@ LSQUnit::init(CPU *cpu_ptr, IEW *iew_ptr, const BaseO3CPUParams &params,
     system = params.system;
 
     depCheckShift = params.LSQDepCheckShift;
+    // violation checks compare depCheckShift granules, so the index may
+    // not be finer than those
+    loadAddrIndex.setGranuleShift(std::max(depCheckShift, 6U));
+    storeAddrIndex.setGranuleShift(std::max(depCheckShift, 6U));
     checkLoads = params.LSQCheckLoads;
     needsTSO = params.needsTSO;
 
@@ -665,10 +667,13 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
      */
     DPRINTF(LSQUnit, "Checking for violations for store [sn:%lli], addr: %#lx\n",
             inst->seqNum, inst->effAddr);
-    while (loadIt != loadQueue.end()) {
+    // Only loads filed near the address can overlap it
+    loadAddrIndex.candidates(inst->effAddr, inst->effSize, loadIt.idx(),
+                             loadQueue.end().idx(), addrCandidates);
+    for (size_t ld_idx : addrCandidates) {
+        loadIt = loadQueue.getIterator(ld_idx);
         DynInstPtr ld_inst = loadIt->instruction();
         if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered()) {
-            ++loadIt;
             continue;
         }
 
@@ -731,8 +736,6 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
                     inst->seqNum, ld_inst->seqNum, ld_eff_addr1);
             }
         }
-
-        ++loadIt;
     }
     return NoFault;
 }
@@ -935,6 +938,7 @@ LSQUnit::commitLoad()
         }
     }
 
+    loadAddrIndex.remove(loadQueue.head());
     loadQueue.front().clear();
     loadQueue.pop_front();
 }
@@ -1321,6 +1325,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         loadQueue.back().instruction()->setSquashed();
         loadQueue.back().clear();
 
+        loadAddrIndex.remove(loadQueue.tail());
         loadQueue.pop_back();
         ++stats.squashedLoads;
     }
@@ -1392,6 +1397,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         // place to really handle request deletes.
         storeQueue.back().clear();
 
+        storeAddrIndex.remove(storeQueue.tail());
         storeQueue.pop_back();
         ++stats.squashedStores;
     }
@@ -1567,6 +1573,7 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx, bool from_sbuffe
 
     if (store_idx == storeQueue.begin()) {
         do {
+            storeAddrIndex.remove(storeQueue.head());
             storeQueue.front().clear();
             storeQueue.pop_front();
         } while (storeQueue.front().completed() &&
@@ -1580,7 +1587,7 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx, bool from_sbuffe
             store_inst->seqNum, store_idx.idx() - 1, storeQueue.head() - 1);
 
 #if TRACING_ON
-    if (debug::O3PipeView) {
+    if (cpu->recordStageTicks()) {
         store_inst->storeTick =
             curTick() - store_inst->fetchTick;
     }
@@ -1797,6 +1804,8 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
     LQEntry& load_entry = loadQueue[load_idx];
     const DynInstPtr& load_inst = load_entry.instruction();
 
+    loadAddrIndex.insert(load_idx, load_inst->effAddr, load_inst->effSize);
+
     DPRINTF(LSQUnit, "request: size: %u, Addr: %#lx\n",
             request->mainReq()->getSize(), request->mainReq()->getVaddr());
 
@@ -1895,12 +1904,19 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
     }
 
     // Check the SQ for any previous stores that might lead to forwarding
-    auto store_it = load_inst->sqIt;
-    assert (store_it >= storeWBIt);
-    // End once we've reached the top of the LSQ
-    while (store_it != storeWBIt && !load_inst->isDataPrefetch()) {
-        // Move the index to one younger
-        store_it--;
+    assert (load_inst->sqIt >= storeWBIt);
+    addrCandidates.clear();
+    if (!load_inst->isDataPrefetch()) {
+        // Only stores filed near the address can forward to it
+        storeAddrIndex.candidates(request->mainReq()->getVaddr(),
+                                  request->mainReq()->getSize(),
+                                  storeWBIt.idx(), load_inst->sqIt.idx(),
+                                  addrCandidates);
+    }
+    // Youngest first, ending once we've reached the top of the LSQ
+    for (auto cand = addrCandidates.rbegin(); cand != addrCandidates.rend();
+         ++cand) {
+        auto store_it = storeQueue.getIterator(*cand);
         assert(store_it->valid());
         assert(store_it->instruction()->seqNum < load_inst->seqNum);
         int store_size = store_it->size();
@@ -2143,6 +2159,8 @@ LSQUnit::write(LSQRequest *request, uint8_t *data, ssize_t store_idx)
     storeQueue[store_idx].setRequest(request);
     unsigned size = request->_size;
     storeQueue[store_idx].size() = size;
+    storeAddrIndex.insert(store_idx,
+                          storeQueue[store_idx].instruction()->effAddr, size);
     bool store_no_data =
         request->mainReq()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
@@ -63,6 +63,7 @@
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq.hh"
+#include "cpu/o3/lsq_addr_index.hh"
 #include "cpu/timebuf.hh"
 #include "debug/HtmCpu.hh"
 #include "debug/LSQUnit.hh"
@@ -309,14 +310,14 @@ class LSQUnit
         Addr blockVaddr;
         Addr blockPaddr;
         std::vector<uint8_t> blockDatas;
-        std::vector<bool> validMask;
+        ByteEnable validMask;
         bool sending = false;
         // merged request
         LSQ::SbufferRequest* request = nullptr;
 
         StoreBufferEntry(int size) {
             blockDatas.resize(size, 0);
-            validMask.resize(size, false);
+            validMask.resize(size);
         }
 
         void reset(uint64_t blockVaddr, uint64_t blockPaddr, uint64_t offset, uint8_t* datas, uint64_t size);
@@ -358,7 +359,9 @@ class LSQUnit
      * contructor is deleted explicitly. However, STL vector requires
      * a valid copy constructor for the base type at compile time.
      */
-    LSQUnit(const LSQUnit &l): storeBuffer(0), stats(nullptr)
+    LSQUnit(const LSQUnit &l)
+        : storeBuffer(0), loadAddrIndex(1, 0), storeAddrIndex(1, 0),
+          stats(nullptr)
     {
         panic("LSQUnit is not copy-able");
     }
@@ -432,6 +435,16 @@ class LSQUnit
 
     bool storeBufferEmpty() { return storeBuffer.size() == 0; }
 
+    /** Is there no store left to move into the store buffer or to evict
+     * from it? Entries already sent only wait for their response.
+     */
+    bool
+    storesQuiescent()
+    {
+        return !isStoreBlocked && storesToWB == 0 &&
+            (storeBuffer.size() == 0 || storeBuffer.unsentSize() == 0);
+    }
+
     void completeSbufferEvict(PacketPtr pkt);
 
     /** Completes the data access that has been returned from the
@@ -631,6 +644,13 @@ class LSQUnit
     LoadQueue loadQueue;
 
   private:
+    /** Load queue entries by the address they read. */
+    LSQAddrIndex loadAddrIndex;
+    /** Store queue entries by the address they write. */
+    LSQAddrIndex storeAddrIndex;
+    /** Candidates of the current index search. */
+    std::vector<size_t> addrCandidates;
+
     /** The number of places to shift addresses in the LSQ before checking
      * for dependency violations
      */
@@ -697,29 +717,29 @@ class LSQUnit
         LSQUnitStats(statistics::Group *parent);
 
         /** Total number of loads forwaded from LSQ stores. */
-        statistics::Scalar forwLoads;
+        statistics::BankedScalar forwLoads;
 
         /** Total number of squashed loads. */
-        statistics::Scalar squashedLoads;
+        statistics::BankedScalar squashedLoads;
 
         /** Total number of responses from the memory system that are
          * ignored due to the instruction already being squashed. */
-        statistics::Scalar ignoredResponses;
+        statistics::BankedScalar ignoredResponses;
 
         /** Tota number of memory ordering violations. */
-        statistics::Scalar memOrderViolation;
+        statistics::BankedScalar memOrderViolation;
 
         /** Total number of squashed stores. */
-        statistics::Scalar squashedStores;
+        statistics::BankedScalar squashedStores;
 
         /** Number of loads that were rescheduled. */
-        statistics::Scalar rescheduledLoads;
+        statistics::BankedScalar rescheduledLoads;
 
         /**Number of bank conflict times**/
-        statistics::Scalar bankConflictTimes;
+        statistics::BankedScalar bankConflictTimes;
 
         /** Number of times the LSQ is blocked due to the cache. */
-        statistics::Scalar blockedByCache;
+        statistics::BankedScalar blockedByCache;
 
         /** Distribution of cycle latency between the first time a load
          * is issued and its completion */
@@ -727,9 +747,9 @@ class LSQUnit
 
         statistics::Distribution loadTranslationLat;
 
-        statistics::Scalar nonUnitStrideCross16Byte;
-        statistics::Scalar unitStrideCross16Byte;
-        statistics::Scalar unitStrideAligned;
+        statistics::BankedScalar nonUnitStrideCross16Byte;
+        statistics::BankedScalar unitStrideCross16Byte;
+        statistics::BankedScalar unitStrideAligned;
     } stats;
 
     void bankConflictReplay();
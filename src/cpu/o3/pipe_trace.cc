@@ -0,0 +1,101 @@
+#include "cpu/o3/pipe_trace.hh"
+
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/o3/comm.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "cpu/o3/issue_queue.hh"
+#include "sim/byteswap.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+PipeTrace::PipeTrace(const std::string &file_name, Tick clock_period)
+    : stream(simout.create(file_name, true))
+{
+    fatal_if(!stream, "Can't create pipeline trace %s.\n", file_name);
+
+    stream->stream()->write("XSPIPETR", 8);
+    put<uint32_t>(version);
+    put<uint32_t>(NumStallReasons);
+    put<uint64_t>(clock_period);
+
+    registerExitCallback([this]() { close(); });
+}
+
+template <typename T>
+void
+PipeTrace::put(T value)
+{
+    value = htole(value);
+    stream->stream()->write(reinterpret_cast<const char *>(&value),
+                            sizeof(T));
+}
+
+void
+PipeTrace::putString(const std::string &str)
+{
+    put<uint16_t>(str.size());
+    stream->stream()->write(str.data(), str.size());
+}
+
+void
+PipeTrace::record(const DynInstPtr &inst)
+{
+#if TRACING_ON
+    // fetched before the trace was opened
+    if (!stream || inst->fetchTick == -1)
+        return;
+
+    Addr pc = inst->pcState().instAddr();
+    MicroPC upc = inst->pcState().microPC();
+    if (knownPCs.emplace(pc, upc).second) {
+        put<uint8_t>('D');
+        put<uint64_t>(pc);
+        put<uint16_t>(upc);
+        std::string disasm = inst->staticInst->disassemble(pc);
+        putString(disasm.substr(0, UINT16_MAX));
+    }
+
+    uint8_t iq_id = NoIQ;
+    if (inst->issueQue) {
+        iq_id = inst->issueQue->getId();
+        if (knownIQs.insert(iq_id).second) {
+            put<uint8_t>('Q');
+            put<uint8_t>(iq_id);
+            putString(inst->issueQue->getName());
+        }
+    }
+
+    put<uint8_t>('I');
+    put<uint64_t>(inst->seqNum);
+    put<uint64_t>(pc);
+    put<uint16_t>(upc);
+    put<uint8_t>(iq_id);
+    put<uint8_t>(inst->robHeadStall);
+    put<uint64_t>(inst->fetchTick);
+    for (int32_t tick : {inst->decodeTick, inst->renameTick,
+                         inst->dispatchTick, inst->issueTick,
+                         inst->completeTick, inst->commitTick}) {
+        put<int32_t>(tick);
+    }
+#endif
+}
+
+void
+PipeTrace::close()
+{
+    if (stream) {
+        simout.close(stream);
+        stream = nullptr;
+    }
+}
+
+} // namespace o3
+} // namespace gem5
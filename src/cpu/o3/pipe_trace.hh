@@ -0,0 +1,87 @@
+/**
+ * @file
+ * Compact binary trace of the pipeline stages every committed instruction
+ * went through, the fast alternative to the O3PipeView debug flag.
+ * util/o3-pipetrace.py converts it to the O3PipeView text read by
+ * util/o3-pipeview.py or to the Konata log format.
+ *
+ * The file is gzip compressed when its name ends in .gz, and starts
+ * with a header:
+ *   char magic[8] = "XSPIPETR", uint32 version, uint32 NumStallReasons,
+ *   uint64 clock period in ticks
+ * followed by records, each starting with a one byte type:
+ *   'D' disassembly, written before the first instruction at a pc.upc:
+ *       uint64 pc, uint16 upc, uint16 length, char text[length]
+ *   'Q' issue queue name, written before the first instruction it issued:
+ *       uint8 id, uint16 length, char name[length]
+ *   'I' instruction:
+ *       uint64 seq num, uint64 pc, uint16 upc, uint8 issue queue id
+ *       (NoIQ if it never went through one), uint8 stall reason blamed on
+ *       it at the ROB head, uint64 fetch tick, int32 decode, rename,
+ *       dispatch, issue, complete and commit ticks relative to fetch
+ *       (-1 if skipped)
+ * All values are little endian.
+ */
+
+#ifndef __CPU_O3_PIPE_TRACE_HH__
+#define __CPU_O3_PIPE_TRACE_HH__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "base/types.hh"
+#include "cpu/o3/dyn_inst_ptr.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace o3
+{
+
+class PipeTrace
+{
+  public:
+    static constexpr uint32_t version = 1;
+    static constexpr uint8_t NoIQ = 0xff;
+
+    /** Create file_name in the output directory. */
+    PipeTrace(const std::string &file_name, Tick clock_period);
+
+    /** Append the record of an instruction retiring now. */
+    void record(const DynInstPtr &inst);
+
+    /** Flush and close the file; called on exit. */
+    void close();
+
+  private:
+    template <typename T>
+    void put(T value);
+
+    void putString(const std::string &str);
+
+    OutputStream *stream;
+
+    /** pc.upc pairs whose disassembly is in the file already. */
+    struct PCHash
+    {
+        size_t
+        operator()(const std::pair<Addr, MicroPC> &pc) const
+        {
+            return std::hash<Addr>()(pc.first) ^ pc.second;
+        }
+    };
+    std::unordered_set<std::pair<Addr, MicroPC>, PCHash> knownPCs;
+
+    /** Issue queues whose name is in the file already. */
+    std::unordered_set<int> knownIQs;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_PIPE_TRACE_HH__
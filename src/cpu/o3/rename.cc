@@ -473,6 +473,19 @@ Rename::tick()
 
 }
 
+bool
+Rename::isQuiescent() const
+{
+    return numThreads == 1 && renameStatus[0] == Blocked &&
+        fromDecode->size == 0;
+}
+
+void
+Rename::creditQuiescentCycles(Cycles cycles)
+{
+    stats.blockCycles += cycles;
+}
+
 void
 Rename::rename(bool &status_change, ThreadID tid)
 {
@@ -909,7 +922,7 @@ Rename::sortInsts()
             insts[inst->threadNumber].push_back(inst);
         }
 #if TRACING_ON
-        if (debug::O3PipeView) {
+        if (cpu->recordStageTicks()) {
             inst->renameTick = curTick() - inst->fetchTick;
         }
 #endif
@@ -208,6 +208,14 @@ class Rename
      */
     void tick();
 
+    /** Is rename blocked with nothing arriving from decode, so that a tick
+     * would only repeat its stall accounting?
+     */
+    bool isQuiescent() const;
+
+    /** Credits the stall accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
+
     /** Debugging function used to dump history buffer of renamings. */
     void dumpHistory();
 
@@ -25,7 +25,7 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-from m5.SimObject import SimObject
+from m5.SimObject import PyBindMethod, SimObject
 from m5.params import *
 from m5.proxy import *
 
@@ -935,6 +935,7 @@ class DecoupledBPUWithFTB(BranchPredictor):
     type = 'DecoupledBPUWithFTB'
     cxx_class = 'gem5::branch_prediction::ftb_pred::DecoupledBPUWithFTB'
     cxx_header = "cpu/pred/ftb/decoupled_bpred.hh"
+    cxx_exports = [PyBindMethod("setDBSwitch")]
     
     # n = 2
     ftq_size = Param.Unsigned(128, "Fetch target queue size")
@@ -195,6 +195,19 @@ class BPredUnit : public SimObject
         BTB.update(instPC, target, 0);
     }
 
+    /**
+     * Trains the predictor with a control instruction committed by
+     * another, functional CPU while the CPU owning this predictor is
+     * switched out. Predictors that keep no warmup state ignore it.
+     * @param tid The thread id.
+     * @param inst The committed control instruction.
+     * @param pc The PC of the instruction.
+     * @param next_pc The PC that followed it.
+     */
+    virtual void
+    functionalWarmup(ThreadID tid, const StaticInstPtr &inst,
+                     const PCStateBase &pc, const PCStateBase &next_pc)
+    {}
 
     void dump();
 
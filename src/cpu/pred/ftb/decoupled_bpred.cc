@@ -61,6 +61,7 @@ DecoupledBPUWithFTB::DecoupledBPUWithFTB(const DecoupledBPUWithFTBParams &p)
             bptrace = bpdb.addAndGetTrace("BPTRACE", fields_vec);
             bptrace->init_table(); 
             removeGivenSwitch(bpDBSwitches, std::string("basic"));
+            createdDBSwitches.push_back("basic");
             someDBenabled = true;
         }
 
@@ -85,6 +86,7 @@ DecoupledBPUWithFTB::DecoupledBPUWithFTB(const DecoupledBPUWithFTBParams &p)
             lptrace = bpdb.addAndGetTrace("LOOPTRACE", loop_fields_vec);
             lptrace->init_table();
             removeGivenSwitch(bpDBSwitches, std::string("loop"));
+            createdDBSwitches.push_back("loop");
             someDBenabled = true;
         }
     }
@@ -109,6 +111,7 @@ DecoupledBPUWithFTB::DecoupledBPUWithFTB(const DecoupledBPUWithFTBParams &p)
                 components[i]->setDB(&bpdb);
                 components[i]->setTrace();
                 removeGivenSwitch(bpDBSwitches, components[i]->dbName);
+                createdDBSwitches.push_back(components[i]->dbName);
                 someDBenabled = true;
             }
         }
@@ -666,6 +669,52 @@ DecoupledBPUWithFTB::tick()
     squashing = false;
 }
 
+bool
+DecoupledBPUWithFTB::isQuiescent()
+{
+    if (squashing || receivedPred || sentPCHist || numOverrideBubbles > 0 ||
+        !streamQueueFull() || !fetchTargetQueue.full()) {
+        return false;
+    }
+
+    // tick() would otherwise try to activate the loop buffer
+    return !enableLoopBuffer || lb.isActive() ||
+        lb.streamBeforeLoop.getTakenTarget() != lb.streamBeforeLoop.startPC ||
+        lb.streamBeforeLoop.resolved;
+}
+
+void
+DecoupledBPUWithFTB::creditQuiescentCycles(Cycles cycles)
+{
+    dbpFtbStats.fsqEntryDist.sample(fetchStreamQueue.size(), cycles);
+    dbpFtbStats.fsqFullCannotEnq += cycles;
+}
+
+void
+DecoupledBPUWithFTB::setDBSwitch(const std::string &switch_name, bool enable)
+{
+    fatal_if(enable && !checkGivenSwitch(createdDBSwitches, switch_name),
+             "%s: trace %s was not in bpDBSwitches, can't enable it.\n",
+             name(), switch_name);
+
+    if (switch_name == "basic") {
+        enableBranchTrace = enable;
+        return;
+    }
+    if (switch_name == "loop") {
+        enableLoopDB = enable;
+        lp.enableDB = enable;
+        return;
+    }
+    for (auto *component : components) {
+        if (component->hasDB && component->dbName == switch_name) {
+            component->enableDB = enable;
+            return;
+        }
+    }
+    fatal("%s: unknown bpDBSwitch %s.\n", name(), switch_name);
+}
+
 // this function collects predictions from all stages and generate bubbles
 // when loop buffer is active, predictions are from saved stream
 void
@@ -2492,6 +2541,154 @@ DecoupledBPUWithFTB::resetPC(Addr new_pc)
     fetchTargetQueue.resetPC(new_pc);
 }
 
+void
+DecoupledBPUWithFTB::warmupPredict(Addr start)
+{
+    for (int i = 0; i < numStages; i++) {
+        predsOfEachStage[i].bbStart = start;
+    }
+    for (int i = 0; i < numComponents; i++) {
+        components[i]->putPCHistory(start, s0History, predsOfEachStage);
+    }
+    // there are no bubbles to model, take the most accurate stage
+    FullFTBPrediction *chosen = &predsOfEachStage[0];
+    for (int i = (int) numStages - 1; i >= 0; i--) {
+        if (predsOfEachStage[i].valid) {
+            chosen = &predsOfEachStage[i];
+            break;
+        }
+    }
+    auto &pred = *chosen;
+
+    auto &stream = warmStream;
+    stream = FetchStream();
+    stream.startPC = start;
+    stream.predMetas.resize(numComponents);
+    if (pred.isReasonable()) {
+        stream.isHit = pred.valid;
+        stream.predFTBEntry = pred.ftbEntry;
+        stream.predTaken = pred.isTaken();
+        stream.predEndPC = pred.getFallThrough();
+        if (stream.predTaken) {
+            stream.predBranchInfo = pred.getTakenSlot().getBranchInfo();
+            stream.predBranchInfo.target = pred.getTarget();
+        }
+    } else {
+        stream.falseHit = true;
+        stream.predEndPC = start + 32;
+    }
+
+    stream.history = s0History;
+    for (int i = 0; i < numComponents; i++) {
+        components[i]->specUpdateHist(s0History, pred);
+        stream.predMetas[i] = components[i]->getPredictionMeta();
+    }
+    int shamt;
+    bool taken;
+    std::tie(shamt, taken) = pred.getHistInfo();
+    histShiftIn(shamt, taken, s0History);
+
+    stream.setDefaultResolve();
+    warmStreamValid = true;
+}
+
+void
+DecoupledBPUWithFTB::warmupCommit(bool mispred, Addr resolve_pc,
+                                  bool is_cond, bool actually_taken)
+{
+    auto &stream = warmStream;
+    if (mispred) {
+        stream.resolved = true;
+        stream.squashPC = resolve_pc;
+        s0History = stream.history;
+        int real_shamt;
+        bool real_taken;
+        std::tie(real_shamt, real_taken) = stream.getHistInfoDuringSquash(
+            resolve_pc, is_cond, actually_taken, numBr);
+        for (int i = 0; i < numComponents; ++i) {
+            components[i]->recoverHist(s0History, stream, real_shamt,
+                                       real_taken);
+        }
+        histShiftIn(real_shamt, real_taken, s0History);
+    }
+
+    if (stream.isHit || stream.exeTaken) {
+        ftb->getAndSetNewFTBEntry(stream);
+        for (int i = 0; i < numComponents; ++i) {
+            components[i]->update(stream);
+        }
+    }
+    warmStreamValid = false;
+}
+
+void
+DecoupledBPUWithFTB::functionalWarmup(ThreadID tid, const StaticInstPtr &inst,
+                                      const PCStateBase &pc,
+                                      const PCStateBase &next_pc)
+{
+    Addr br_pc = pc.instAddr();
+    Addr fall_thru = pc.getFallThruPC();
+    bool taken = next_pc.instAddr() != fall_thru;
+    Addr target = taken || !inst->isDirectCtrl() ?
+        next_pc.instAddr() : inst->branchTarget(pc)->instAddr();
+    BranchInfo info(br_pc, target, inst, fall_thru - br_pc);
+
+    if (br_pc < warmPC || br_pc - warmPC >= maxWarmupGap) {
+        DPRINTF(DecoupleBP, "Warmup restarts at %#lx\n", br_pc);
+        warmStreamValid = false;
+        warmPC = br_pc;
+    }
+
+    while (true) {
+        if (!warmStreamValid) {
+            warmupPredict(warmPC);
+        }
+        auto &stream = warmStream;
+        if (stream.predTaken && stream.predBranchInfo.pc < br_pc) {
+            // nothing was committed at the predicted branch, which the
+            // pipeline would find out through a non-control squash
+            Addr false_br = stream.predBranchInfo.pc;
+            stream.squashType = SQUASH_OTHER;
+            stream.exeTaken = false;
+            stream.exeBranchInfo = BranchInfo();
+            warmupCommit(true, false_br, false, false);
+            warmPC = false_br > stream.startPC ?
+                false_br : stream.predBranchInfo.getEnd();
+            continue;
+        }
+        if (!stream.predTaken && br_pc >= stream.predEndPC) {
+            // correctly predicted fall through block
+            warmupCommit(false, 0, false, false);
+            warmPC = stream.predEndPC > stream.startPC ?
+                stream.predEndPC : stream.startPC + 32;
+            continue;
+        }
+        break;
+    }
+
+    auto &stream = warmStream;
+    bool pred_taken_here =
+        stream.predTaken && stream.predBranchInfo.pc == br_pc;
+    if (taken) {
+        bool mispred =
+            !pred_taken_here || stream.predBranchInfo.target != target;
+        if (mispred) {
+            stream.squashType = SQUASH_CTRL;
+        }
+        stream.exeTaken = true;
+        stream.exeBranchInfo = info;
+        warmupCommit(mispred, br_pc, info.isCond, true);
+        warmPC = target;
+    } else if (pred_taken_here) {
+        stream.squashType = SQUASH_CTRL;
+        stream.exeTaken = false;
+        stream.exeBranchInfo = info;
+        warmupCommit(true, br_pc, info.isCond, false);
+        warmPC = fall_thru;
+    }
+    // a not taken branch predicted as such stays in the open block
+}
+
 Cycles
 DecoupledBPUWithFTB::curCycle()
 {
@@ -248,9 +248,11 @@ class DecoupledBPUWithFTB : public BPredUnit
         auto it = std::remove(switches.begin(), switches.end(), switchName);
         switches.erase(it, switches.end());
     }
+    /** Switches whose traces were created at construction. */
+    std::vector<std::string> createdDBSwitches;
     DataBase bpdb;
-    TraceManager *bptrace;
-    TraceManager *lptrace;
+    TraceManager *bptrace{};
+    TraceManager *lptrace{};
 
 
 
@@ -273,6 +275,34 @@ class DecoupledBPUWithFTB : public BPredUnit
 
     HistoryManager historyManager;
 
+    /**
+     * Functional warmup forms fetch blocks from the committed control
+     * instructions of another CPU. warmStream is the block being formed,
+     * warmPC the start of that block or of the next one.
+     */
+    /** @{ */
+    FetchStream warmStream;
+    bool warmStreamValid{false};
+    Addr warmPC{0};
+    /** @} */
+
+    /**
+     * A committed branch further than this from warmPC is taken to follow
+     * a trap or a switch, and restarts block formation at the branch.
+     */
+    const Addr maxWarmupGap{0x1000};
+
+    /** Predict the warmup block starting at start, as tick() would. */
+    void warmupPredict(Addr start);
+
+    /**
+     * Resolve the warmup block and train the components with it, as
+     * update() does at commit. A mispredicted block first has its
+     * history recovered at resolve_pc, as the squashes do.
+     */
+    void warmupCommit(bool mispred, Addr resolve_pc, bool is_cond,
+                      bool actually_taken);
+
     unsigned numOverrideBubbles{0};
 
 
@@ -531,6 +561,21 @@ class DecoupledBPUWithFTB : public BPredUnit
   public:
     void tick();
 
+    /** Would a tick leave the BPU untouched? True while both the FSQ and
+     * the FTQ are full and no prediction is in flight.
+     */
+    bool isQuiescent();
+
+    /** Credits the queue accounting of cycles skipped while quiescent. */
+    void creditQuiescentCycles(Cycles cycles);
+
+    /**
+     * Turn a database trace on or off at runtime, e.g. in a child of a
+     * fork sweep. Tables are only created at construction, so a trace
+     * can only be turned back on if it was listed in bpDBSwitches.
+     */
+    void setDBSwitch(const std::string &switch_name, bool enable);
+
     bool trySupplyFetchWithTarget(Addr fetch_demand_pc, bool &fetchTargetInLoop);
 
     void squash(const InstSeqNum &squashed_sn, ThreadID tid)
@@ -595,6 +640,9 @@ class DecoupledBPUWithFTB : public BPredUnit
         return fetchTargetQueue.fetchTargetAvailable();
     }
 
+    bool ftqEmpty() const { return fetchTargetQueue.empty(); }
+    bool ftqFull() const { return fetchTargetQueue.full(); }
+
     FtqEntry& getSupplyingFetchTarget()
     {
         return fetchTargetQueue.getTarget();
@@ -708,6 +756,10 @@ class DecoupledBPUWithFTB : public BPredUnit
 
     void resetPC(Addr new_pc);
 
+    void functionalWarmup(ThreadID tid, const StaticInstPtr &inst,
+                          const PCStateBase &pc,
+                          const PCStateBase &next_pc) override;
+
     enum CfiType {
         COND,
         UNCOND,
@@ -83,6 +83,93 @@ DefaultFTB::DefaultFTB(const Params &p)
         numEntries, numSets, numWays, tagBits, tagShiftAmt, idxMask, tagMask);
 }
 
+std::string
+DefaultFTB::warmStateGeometry() const
+{
+    return csprintf("sets=%d ways=%d tagBits=%d numBr=%d",
+                    numSets, numWays, tagBits, numBr);
+}
+
+void
+DefaultFTB::saveWarmState(WarmStateOut &out) const
+{
+    for (const auto &set : ftb) {
+        std::vector<const TickedFTBEntry *> entries;
+        for (const auto &it : set) {
+            if (it.second.valid)
+                entries.push_back(&it.second);
+        }
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const TickedFTBEntry *a, const TickedFTBEntry *b) {
+                return a->tick < b->tick;
+            });
+
+        out.put<uint32_t>(entries.size());
+        for (const auto *entry : entries) {
+            out.put(entry->tag);
+            out.put(entry->fallThruAddr);
+            out.put(entry->tid);
+            out.put<uint32_t>(entry->slots.size());
+            for (const auto &slot : entry->slots) {
+                out.put(slot.pc);
+                out.put(slot.target);
+                out.put(slot.isCond);
+                out.put(slot.isIndirect);
+                out.put(slot.isCall);
+                out.put(slot.isReturn);
+                out.put(slot.size);
+                out.put(slot.valid);
+                out.put(slot.alwaysTaken);
+                out.put(slot.ctr);
+            }
+        }
+    }
+}
+
+void
+DefaultFTB::loadWarmState(WarmStateIn &in)
+{
+    for (unsigned i = 0; i < numSets; ++i) {
+        auto &set = ftb[i];
+        set.clear();
+
+        uint32_t num_entries = in.get<uint32_t>();
+        for (uint32_t rank = 0; rank < num_entries; ++rank) {
+            FTBEntry entry;
+            in.get(entry.tag);
+            in.get(entry.fallThruAddr);
+            in.get(entry.tid);
+            entry.slots.resize(in.get<uint32_t>());
+            for (auto &slot : entry.slots) {
+                in.get(slot.pc);
+                in.get(slot.target);
+                in.get(slot.isCond);
+                in.get(slot.isIndirect);
+                in.get(slot.isCall);
+                in.get(slot.isReturn);
+                in.get(slot.size);
+                in.get(slot.valid);
+                in.get(slot.alwaysTaken);
+                in.get(slot.ctr);
+            }
+            entry.valid = true;
+            // this run restarts from tick 0, so only the order is kept;
+            // the dummy entries below stay older than every real one
+            set[entry.tag] = TickedFTBEntry(entry, rank + 1);
+        }
+
+        for (unsigned j = 0; set.size() < numWays; ++j) {
+            set[0xfffffff-j]; // dummy initialization
+        }
+
+        mruList[i].clear();
+        for (auto it = set.begin(); it != set.end(); it++) {
+            mruList[i].push_back(it);
+        }
+        std::make_heap(mruList[i].begin(), mruList[i].end(), older());
+    }
+}
+
 void
 DefaultFTB::tickStart()
 {
@@ -38,6 +38,7 @@
 #include "debug/FTB.hh"
 #include "debug/FTBStats.hh"
 #include "params/DefaultFTB.hh"
+#include "sim/warm_state.hh"
 
 
 namespace gem5
@@ -49,7 +50,7 @@ namespace branch_prediction
 namespace ftb_pred
 {
 
-class DefaultFTB : public TimedBaseFTBPredictor
+class DefaultFTB : public TimedBaseFTBPredictor, public WarmStateful
 {
   private:
 
@@ -120,6 +121,15 @@ class DefaultFTB : public TimedBaseFTBPredictor
 
     void commitBranch(const FetchStream &stream, const DynInstPtr &inst) override;
 
+    std::string warmStateName() const override { return name(); }
+    std::string warmStateGeometry() const override;
+
+    /** Saves the valid entries of each set, least recently updated first. */
+    void saveWarmState(WarmStateOut &out) const override;
+
+    /** Restores the entries, keeping their replacement order. */
+    void loadWarmState(WarmStateIn &in) override;
+
     /**
      * @brief derive new ftb entry from old ones and set updateFTBEntry field in stream
      *        only in L1FTB will this function be called when update
@@ -63,6 +63,45 @@ FTBITTAGE::FTBITTAGE(const Params& p)
     usefulResetCnt = 0;
 }
 
+std::string
+FTBITTAGE::warmStateGeometry() const
+{
+    std::string geometry = "tables=";
+    for (const auto &table : tageTable)
+        geometry += csprintf("%d,", table.size());
+    return geometry;
+}
+
+void
+FTBITTAGE::saveWarmState(WarmStateOut &out) const
+{
+    for (const auto &table : tageTable) {
+        for (const auto &entry : table) {
+            out.put(entry.valid);
+            out.put(entry.tag);
+            out.put(entry.target);
+            out.put(entry.counter);
+            out.put(entry.useful);
+        }
+    }
+    out.put(usefulResetCnt);
+}
+
+void
+FTBITTAGE::loadWarmState(WarmStateIn &in)
+{
+    for (auto &table : tageTable) {
+        for (auto &entry : table) {
+            in.get(entry.valid);
+            in.get(entry.tag);
+            in.get(entry.target);
+            in.get(entry.counter);
+            in.get(entry.useful);
+        }
+    }
+    in.get(usefulResetCnt);
+}
+
 void
 FTBITTAGE::tickStart()
 {
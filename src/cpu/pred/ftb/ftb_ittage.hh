@@ -16,6 +16,7 @@
 #include "params/FTBITTAGE.hh"
 #include "debug/DecoupleBP.hh"
 #include "sim/sim_object.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -26,7 +27,7 @@ namespace branch_prediction
 namespace ftb_pred
 {
 
-class FTBITTAGE : public TimedBaseFTBPredictor
+class FTBITTAGE : public TimedBaseFTBPredictor, public WarmStateful
 {
     using defer = std::shared_ptr<void>;
     using bitset = boost::dynamic_bitset<>;
@@ -97,6 +98,13 @@ class FTBITTAGE : public TimedBaseFTBPredictor
 
     void commitBranch(const FetchStream &stream, const DynInstPtr &inst) override;
 
+    std::string warmStateName() const override { return name(); }
+    std::string warmStateGeometry() const override;
+
+    /** Saves the tagged tables; folded histories start empty. */
+    void saveWarmState(WarmStateOut &out) const override;
+    void loadWarmState(WarmStateIn &in) override;
+
     // check folded hists after speculative update and recover
     void checkFoldedHist(const bitset &history, const char *when);
 
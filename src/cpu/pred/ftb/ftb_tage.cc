@@ -129,6 +129,68 @@ FTBTAGE::setTrace()
 void
 FTBTAGE::tick() {}
 
+std::string
+FTBTAGE::warmStateGeometry() const
+{
+    std::string geometry = csprintf("numBr=%d base=%d useAlt=%d tables=",
+                                    numBr, baseTable.size(), useAlt.size());
+    for (const auto &table : tageTable)
+        geometry += csprintf("%d,", table.size());
+    return geometry + " " + sc.warmStateGeometry();
+}
+
+void
+FTBTAGE::saveWarmState(WarmStateOut &out) const
+{
+    for (const auto &table : tageTable) {
+        for (const auto &set : table) {
+            for (const auto &entry : set) {
+                out.put(entry.valid);
+                out.put(entry.tag);
+                out.put(entry.counter);
+                out.put(entry.useful);
+            }
+        }
+    }
+    for (const auto &ctrs : baseTable) {
+        for (short ctr : ctrs)
+            out.put(ctr);
+    }
+    for (const auto &ctrs : useAlt) {
+        for (short ctr : ctrs)
+            out.put(ctr);
+    }
+    for (int cnt : usefulResetCnt)
+        out.put(cnt);
+    sc.saveWarmState(out);
+}
+
+void
+FTBTAGE::loadWarmState(WarmStateIn &in)
+{
+    for (auto &table : tageTable) {
+        for (auto &set : table) {
+            for (auto &entry : set) {
+                in.get(entry.valid);
+                in.get(entry.tag);
+                in.get(entry.counter);
+                in.get(entry.useful);
+            }
+        }
+    }
+    for (auto &ctrs : baseTable) {
+        for (auto &ctr : ctrs)
+            in.get(ctr);
+    }
+    for (auto &ctrs : useAlt) {
+        for (auto &ctr : ctrs)
+            in.get(ctr);
+    }
+    for (auto &cnt : usefulResetCnt)
+        in.get(cnt);
+    sc.loadWarmState(in);
+}
+
 void
 FTBTAGE::tickStart() {}
 
@@ -732,6 +794,50 @@ FTBTAGE::StatisticalCorrector::satNeg(int &counter, int counterBits)
     return counter == -(1 << (counterBits-1));
 }
 
+std::string
+FTBTAGE::StatisticalCorrector::warmStateGeometry() const
+{
+    std::string geometry = csprintf("sc=%d ctr=%d tc=%d tables=",
+                                    numBr, scCounterWidth, TCWidth);
+    for (int i = 0; i < numPredictors; i++)
+        geometry += csprintf("%d/%d,", tableSizes[i], histLens[i]);
+    return geometry;
+}
+
+void
+FTBTAGE::StatisticalCorrector::saveWarmState(WarmStateOut &out) const
+{
+    for (const auto &table : scCntTable) {
+        for (const auto &br_counters : table) {
+            for (const auto &t_or_nt : br_counters) {
+                for (int ctr : t_or_nt)
+                    out.put(ctr);
+            }
+        }
+    }
+    for (int thres : thresholds)
+        out.put(thres);
+    for (int tc : TCs)
+        out.put(tc);
+}
+
+void
+FTBTAGE::StatisticalCorrector::loadWarmState(WarmStateIn &in)
+{
+    for (auto &table : scCntTable) {
+        for (auto &br_counters : table) {
+            for (auto &t_or_nt : br_counters) {
+                for (auto &ctr : t_or_nt)
+                    in.get(ctr);
+            }
+        }
+    }
+    for (auto &thres : thresholds)
+        in.get(thres);
+    for (auto &tc : TCs)
+        in.get(tc);
+}
+
 Addr
 FTBTAGE::StatisticalCorrector::getIndex(Addr pc, int t)
 {
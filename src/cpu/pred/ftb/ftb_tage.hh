@@ -16,6 +16,7 @@
 #include "debug/FTBTAGEUseful.hh"
 #include "params/FTBTAGE.hh"
 #include "sim/sim_object.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -26,7 +27,7 @@ namespace branch_prediction
 namespace ftb_pred
 {
 
-class FTBTAGE : public TimedBaseFTBPredictor
+class FTBTAGE : public TimedBaseFTBPredictor, public WarmStateful
 {
     using defer = std::shared_ptr<void>;
     using bitset = boost::dynamic_bitset<>;
@@ -98,6 +99,16 @@ class FTBTAGE : public TimedBaseFTBPredictor
 
     void setTrace() override;
 
+    std::string warmStateName() const override { return name(); }
+    std::string warmStateGeometry() const override;
+
+    /**
+     * Saves the tagged, base and use-alt tables and the statistical
+     * corrector. Folded histories are path state and start empty.
+     */
+    void saveWarmState(WarmStateOut &out) const override;
+    void loadWarmState(WarmStateIn &in) override;
+
     // check folded hists after speculative update and recover
     void checkFoldedHist(const bitset &history, const char *when);
 
@@ -185,47 +196,47 @@ class FTBTAGE : public TimedBaseFTBPredictor
 
     struct TageBankStats : public statistics::Group {
         statistics::Distribution predTableHits;
-        statistics::Scalar predNoHitUseBim;
-        statistics::Scalar predUseAlt;
+        statistics::BankedScalar predNoHitUseBim;
+        statistics::BankedScalar predUseAlt;
         statistics::Distribution updateTableHits;
-        statistics::Scalar updateNoHitUseBim;
-        statistics::Scalar updateUseAlt;
+        statistics::BankedScalar updateNoHitUseBim;
+        statistics::BankedScalar updateUseAlt;
     
-        statistics::Scalar updateUseAltCorrect;
-        statistics::Scalar updateUseAltWrong;
-        statistics::Scalar updateAltDiffers;
-        statistics::Scalar updateUseAltOnNaUpdated;
-        statistics::Scalar updateUseAltOnNaInc;
-        statistics::Scalar updateUseAltOnNaDec;
-        statistics::Scalar updateProviderNa;
-        statistics::Scalar updateUseNaCorrect;
-        statistics::Scalar updateUseNaWrong;
-        statistics::Scalar updateUseAltOnNa;
-        statistics::Scalar updateUseAltOnNaCorrect;
-        statistics::Scalar updateUseAltOnNaWrong;
-        statistics::Scalar updateAllocFailure;
-        statistics::Scalar updateAllocSuccess;
-        statistics::Scalar updateMispred;
-        statistics::Scalar updateResetU;
+        statistics::BankedScalar updateUseAltCorrect;
+        statistics::BankedScalar updateUseAltWrong;
+        statistics::BankedScalar updateAltDiffers;
+        statistics::BankedScalar updateUseAltOnNaUpdated;
+        statistics::BankedScalar updateUseAltOnNaInc;
+        statistics::BankedScalar updateUseAltOnNaDec;
+        statistics::BankedScalar updateProviderNa;
+        statistics::BankedScalar updateUseNaCorrect;
+        statistics::BankedScalar updateUseNaWrong;
+        statistics::BankedScalar updateUseAltOnNa;
+        statistics::BankedScalar updateUseAltOnNaCorrect;
+        statistics::BankedScalar updateUseAltOnNaWrong;
+        statistics::BankedScalar updateAllocFailure;
+        statistics::BankedScalar updateAllocSuccess;
+        statistics::BankedScalar updateMispred;
+        statistics::BankedScalar updateResetU;
         statistics::Distribution updateResetUCtrInc;
         statistics::Distribution updateResetUCtrDec;
 
-        statistics::Vector updateTableMispreds;
-
-        statistics::Scalar scAgreeAtPred;
-        statistics::Scalar scAgreeAtCommit;
-        statistics::Scalar scDisagreeAtPred;
-        statistics::Scalar scDisagreeAtCommit;
-        statistics::Scalar scConfAtPred;
-        statistics::Scalar scConfAtCommit;
-        statistics::Scalar scUnconfAtPred;
-        statistics::Scalar scUnconfAtCommit;
-        statistics::Scalar scUpdateOnMispred;
-        statistics::Scalar scUpdateOnUnconf;
-        statistics::Scalar scUsedAtPred;
-        statistics::Scalar scUsedAtCommit;
-        statistics::Scalar scCorrectTageWrong;
-        statistics::Scalar scWrongTageCorrect;
+        statistics::BankedVector updateTableMispreds;
+
+        statistics::BankedScalar scAgreeAtPred;
+        statistics::BankedScalar scAgreeAtCommit;
+        statistics::BankedScalar scDisagreeAtPred;
+        statistics::BankedScalar scDisagreeAtCommit;
+        statistics::BankedScalar scConfAtPred;
+        statistics::BankedScalar scConfAtCommit;
+        statistics::BankedScalar scUnconfAtPred;
+        statistics::BankedScalar scUnconfAtCommit;
+        statistics::BankedScalar scUpdateOnMispred;
+        statistics::BankedScalar scUpdateOnUnconf;
+        statistics::BankedScalar scUsedAtPred;
+        statistics::BankedScalar scUsedAtCommit;
+        statistics::BankedScalar scCorrectTageWrong;
+        statistics::BankedScalar scWrongTageCorrect;
 
         int bankIdx;
         int numPredictors;
@@ -329,6 +340,13 @@ public:
           this->stats = stats;
         }
 
+        /** Table and counter dimensions, part of the FTBTAGE geometry. */
+        std::string warmStateGeometry() const;
+
+        void saveWarmState(WarmStateOut &out) const;
+
+        void loadWarmState(WarmStateIn &in);
+
       private:
         int numBr;
 
@@ -73,13 +73,39 @@ class JumpAheadPredictor
 
 
 
-    std::vector<std::map<Addr, JAEntry>> jaStorage;
-    // std::map<Addr, JAEntry> commitJaStorage;
-
-
-    
+    typedef struct JAWay {
+        bool valid{false};
+        Addr tag{0};
+        Tick tick{0};
+        JAEntry entry;
+    } JAWay;
+
+    // numSets x numWays, allocated once at construction
+    std::vector<std::vector<JAWay>> jaStorage;
+
+    JAWay *findWay(unsigned idx, Addr tag) {
+      for (auto &way : jaStorage[idx]) {
+        if (way.valid && way.tag == tag) {
+          return &way;
+        }
+      }
+      return nullptr;
+    }
 
-    // TODO: replacement policy
+    // invalid way first, otherwise the least recently used one
+    JAWay &getVictim(unsigned idx) {
+      auto &set = jaStorage[idx];
+      JAWay *victim = &set[0];
+      for (auto &way : set) {
+        if (!way.valid) {
+          return way;
+        }
+        if (way.tick < victim->tick) {
+          victim = &way;
+        }
+      }
+      return *victim;
+    }
 
     int getIndex(Addr pc) {return (pc >> 1) & idxMask;}
 
@@ -90,17 +116,17 @@ class JumpAheadPredictor
       auto idx = getIndex(pc);
       auto tag = getTag(pc);
       DPRINTF(JumpAheadPredictor, "lookup: pc: %#lx, index: %d, tag %#lx\n", pc, idx, tag);
-      auto &set = jaStorage[idx];
-      auto it = set.find(tag);
-      if (it != set.end()) {
-        int conf = it->second.conf;
+      auto way = findWay(idx, tag);
+      if (way) {
+        way->tick = curTick();
+        int conf = way->entry.conf;
         Addr target = 0;
         if (conf == maxConf) {
-          target = it->second.getJumpTarget(pc, blockSize);
+          target = way->entry.getJumpTarget(pc, blockSize);
         }
         DPRINTF(JumpAheadPredictor, "found jumpAheadBlockNum: %d, conf: %d, shouldJumpTo: %#lx\n",
-          it->second.jumpAheadBlockNum, it->second.conf, target);
-        return std::make_tuple(true, conf == maxConf, it->second, target);
+          way->entry.jumpAheadBlockNum, way->entry.conf, target);
+        return std::make_tuple(true, conf == maxConf, way->entry, target);
       }
       return std::make_tuple(false, false, JAEntry(), 0);
     }
@@ -109,10 +135,9 @@ class JumpAheadPredictor
       DPRINTF(JumpAheadPredictor, "invalidate: pc: %#lx\n", startPC);
       auto idx = getIndex(startPC);
       auto tag = getTag(startPC);
-      auto &set = jaStorage[idx];
-      auto it = set.find(tag);
-      if (it != set.end()) {
-        it->second.conf = 0;
+      auto way = findWay(idx, tag);
+      if (way) {
+        way->entry.conf = 0;
       }
     }
 
@@ -121,29 +146,33 @@ class JumpAheadPredictor
         auto pc = info.firstNoPredBlockStart;
         auto idx = getIndex(pc);
         auto tag = getTag(pc);
-        auto &set = jaStorage[idx];
-        auto it = set.find(tag);
+        auto way = findWay(idx, tag);
         DPRINTF(JumpAheadPredictor, "tryUpdate: pc %#lx, idx: %d, tag: %#lx, noPredBlockCount: %d\n",
           pc, idx, tag, info.noPredBlockCount);
-        if (it != set.end()) {
-          if (it->second.jumpAheadBlockNum != info.noPredBlockCount) {
-            it->second.jumpAheadBlockNum = info.noPredBlockCount;
-            it->second.conf -= 4;
-            if (it->second.conf < 0) {
-              it->second.conf = 0;
+        if (way) {
+          auto &entry = way->entry;
+          if (entry.jumpAheadBlockNum != info.noPredBlockCount) {
+            entry.jumpAheadBlockNum = info.noPredBlockCount;
+            entry.conf -= 4;
+            if (entry.conf < 0) {
+              entry.conf = 0;
             }
           } else {
-            if (it->second.conf < maxConf) {
-              it->second.conf++;
+            if (entry.conf < maxConf) {
+              entry.conf++;
             }
           }
-          DPRINTF(JumpAheadPredictor, "found, update jumpAheadBlockNum to %d, conf to %d\n", it->second.jumpAheadBlockNum, it->second.conf);
+          way->tick = curTick();
+          DPRINTF(JumpAheadPredictor, "found, update jumpAheadBlockNum to %d, conf to %d\n", entry.jumpAheadBlockNum, entry.conf);
         } else {
           DPRINTF(JumpAheadPredictor, "not found, insert new entry of block num %d\n", info.noPredBlockCount);
-          JAEntry entry;
-          entry.jumpAheadBlockNum = info.noPredBlockCount;
-          entry.conf = 0;
-          set[tag] = entry;
+          auto &victim = getVictim(idx);
+          victim.valid = true;
+          victim.tag = tag;
+          victim.tick = curTick();
+          victim.entry = JAEntry();
+          victim.entry.jumpAheadBlockNum = info.noPredBlockCount;
+          victim.entry.conf = 0;
         }
       }
     }
@@ -152,13 +181,7 @@ class JumpAheadPredictor
       numSets = sets;
       numWays = ways;
       idxMask = (1 << ceilLog2(numSets)) - 1;
-      jaStorage.resize(numSets);
-      for (unsigned i = 0; i < numWays; i++) {
-        for (auto set : jaStorage) {
-          set[0xffffff-i];
-        }
-        // commitJaStorage[0xfffffef-i];
-      }
+      jaStorage.assign(numSets, std::vector<JAWay>(numWays));
       //       VaddrBits   instOffsetBits  log2Ceil(PredictWidth)
       tagSize = 39 - 1 - ceilLog2(numSets);
       tagMask = (1ULL << tagSize) - 1;
@@ -1,6 +1,7 @@
 #ifndef __CPU_PRED_FTB_LOOP_BUFFER_HH__
 #define __CPU_PRED_FTB_LOOP_BUFFER_HH__
 
+#include <algorithm>
 #include <array>
 #include <queue>
 #include <stack>
@@ -32,7 +33,13 @@ class LoopBuffer
 
     LoopPredictor *lp;
 
-    int maxLoopInsts{16};
+    // capacity of a single loop entry, in instructions
+    static constexpr int MaxLoopInsts = 16;
+    // spec loop entries are kept in a small set-associative table
+    static constexpr unsigned SpecSets = 4;
+    static constexpr unsigned SpecWays = 2;
+
+    int maxLoopInsts{MaxLoopInsts};
 
     // filled at fetch time
     typedef struct InstDesc {
@@ -41,6 +48,17 @@ class LoopBuffer
         Addr pc;
     } InstDesc;
 
+    // a loop body with its instruction descriptors stored inline
+    typedef struct LoopEntry {
+        bool valid{false};
+        Addr pc{0};
+        int size{0};
+        Tick tick{0};
+        std::array<InstDesc, MaxLoopInsts> insts;
+
+        const InstDesc &back() const { return insts[size - 1]; }
+    } LoopEntry;
+
     InstDesc genInstDesc(bool compressed, StaticInstPtr inst, Addr pc) {
         InstDesc desc;
         desc.compressed = compressed;
@@ -48,11 +66,38 @@ class LoopBuffer
         desc.pc = pc;
         return desc;
     }
-    std::map<Addr, std::vector<InstDesc>> specLoopInsts;
-    
-    
+    std::array<std::array<LoopEntry, SpecWays>, SpecSets> specLoopInsts;
+
+    unsigned getSpecIndex(Addr pc) { return (pc >> 1) % SpecSets; }
+
+    LoopEntry *findSpecEntry(Addr pc)
+    {
+        for (auto &way : specLoopInsts[getSpecIndex(pc)]) {
+            if (way.valid && way.pc == pc) {
+                return &way;
+            }
+        }
+        return nullptr;
+    }
+
+    // invalid way first, otherwise the least recently filled one
+    LoopEntry &getSpecVictim(Addr pc)
+    {
+        auto &set = specLoopInsts[getSpecIndex(pc)];
+        LoopEntry *victim = &set[0];
+        for (auto &way : set) {
+            if (!way.valid) {
+                return way;
+            }
+            if (way.tick < victim->tick) {
+                victim = &way;
+            }
+        }
+        return *victim;
+    }
+
     // used in loop
-    std::pair<Addr, std::vector<InstDesc>> loopInsts;
+    LoopEntry loopInsts;
     Addr loopBranchPC;
     // entry is pinned when current loop is still require by fetch
     int pinnedCounter{0};
@@ -78,10 +123,10 @@ class LoopBuffer
          */
         Addr branch_pc = streamBeforeLoop.getControlPC();
         DPRINTF(LoopBuffer, "query loop buffer with start pc %#lx\n", start_pc);
-        if (loopInsts.first == start_pc && streamBeforeLoop.predTaken &&
+        if (loopInsts.valid && loopInsts.pc == start_pc && streamBeforeLoop.predTaken &&
                 loopBranchPC == branch_pc) {
             DPRINTF(LoopBuffer, "found loop buffer entry for pc %#lx, branch_pc %#lx, entry has %d insts\n",
-                start_pc, branch_pc, loopInsts.second.size());
+                start_pc, branch_pc, loopInsts.size);
             const auto lentry = lp->lookUp(loopBranchPC);
             if (lentry.valid) {
                 bool conf = lp->isConf(lentry);
@@ -153,9 +198,9 @@ class LoopBuffer
 
     bool isActive() { return active; }
 
-    Addr getActiveLoopStart() { return loopInsts.first; }
+    Addr getActiveLoopStart() { return loopInsts.pc; }
 
-    int getActiveLoopInstsSize() { return loopInsts.second.size(); }
+    int getActiveLoopInstsSize() { return loopInsts.size; }
 
     Addr getActiveLoopBranch() { return loopBranchPC; }
 
@@ -167,32 +212,42 @@ class LoopBuffer
     // and the entry is ended by a backward taken branch
     bool fillSpecLoopBuffer(Addr pc, const std::vector<InstDesc> &insts)
     {
-        // TODO: use replacement policy
-        const auto &it = specLoopInsts.find(pc);
-        if (it != specLoopInsts.end() && insts.size() == it->second.size()) {
+        if (insts.empty() || insts.size() > MaxLoopInsts) {
+            return false;
+        }
+        LoopEntry *entry = findSpecEntry(pc);
+        if (entry && static_cast<int>(insts.size()) == entry->size) {
             DPRINTF(LoopBuffer, "found identical spec loop buffer entry for pc %#lx, don't fill, entry has %d insts\n",
-                pc, it->second.size());
+                pc, entry->size);
             return false;
         } else {
-            specLoopInsts[pc] = insts;
+            if (!entry) {
+                entry = &getSpecVictim(pc);
+                if (entry->valid) {
+                    DPRINTF(LoopBuffer, "evicting spec loop buffer entry for pc %#lx\n", entry->pc);
+                }
+            }
+            entry->valid = true;
+            entry->pc = pc;
+            entry->size = insts.size();
+            entry->tick = curTick();
+            std::copy(insts.begin(), insts.end(), entry->insts.begin());
             return true;
         }
     }
 
     void commitLoopPeek(Addr pc, Addr branch_pc) {
-        const auto &it = specLoopInsts.find(pc);
+        const LoopEntry *entry = findSpecEntry(pc);
         DPRINTF(LoopBuffer, "commit loop peek, pc %#lx, branch pc %#lx\n", pc, branch_pc);
         if (!pinned()) {
-            if (it != specLoopInsts.end()) {
-                if (it->second.back().pc == branch_pc) {
-                    loopInsts.first = pc;
-                    loopInsts.second = it->second;
+            if (entry) {
+                if (entry->back().pc == branch_pc) {
+                    loopInsts = *entry;
                     loopBranchPC = branch_pc;
                     DPRINTF(LoopBuffer, "found spec loop buffer entry for pc %#lx, branch pc %#lx, entry has %d insts\n",
-                        pc, branch_pc, loopInsts.second.size());
-                    // specLoopInsts.erase(it);
+                        pc, branch_pc, loopInsts.size);
                 } else {
-                    DPRINTF(LoopBuffer, "entry has different branch pc %#lx, don't write into main\n", it->second.back().pc);
+                    DPRINTF(LoopBuffer, "entry has different branch pc %#lx, don't write into main\n", entry->back().pc);
                 }
             }
         } else {
@@ -202,10 +257,10 @@ class LoopBuffer
 
     InstDesc supplyInst() {
         DPRINTF(LoopBuffer, "supplying inst from loop buffer, loopInstCounter %d, buffer size %d, loop buffer pc %#lx\n",
-            loopInstCounter, loopInsts.second.size(), loopInsts.first);
-        if (loopInstCounter < loopInsts.second.size()) {
-            auto instDesc = loopInsts.second[loopInstCounter];
-            if (++loopInstCounter >= loopInsts.second.size()) {
+            loopInstCounter, loopInsts.size, loopInsts.pc);
+        if (loopInstCounter < loopInsts.size) {
+            auto instDesc = loopInsts.insts[loopInstCounter];
+            if (++loopInstCounter >= loopInsts.size) {
                 loopInstCounter = 0;
             }
             return instDesc;
@@ -216,8 +271,8 @@ class LoopBuffer
     }
 
     int getLoopInstNum(Addr pc) {
-        if (loopInsts.first == pc) {
-            return loopInsts.second.size();
+        if (loopInsts.valid && loopInsts.pc == pc) {
+            return loopInsts.size;
         } else {
             // FIXME: record in fsq entry
             return 0;
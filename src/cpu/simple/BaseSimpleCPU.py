@@ -38,3 +38,6 @@ class BaseSimpleCPU(BaseCPU):
     cxx_class = 'gem5::BaseSimpleCPU'
 
     branchPred = Param.BranchPredictor(NULL, "Branch Predictor")
+    warmupBranchPred = Param.BranchPredictor(NULL, "Switched out "
+            "predictor trained with the committed control instructions "
+            "during functional warmup")
@@ -338,7 +338,7 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
 bool
 AtomicSimpleCPU::genMemFragmentRequest(const RequestPtr &req, Addr frag_addr,
                                        int size, Request::Flags flags,
-                                       const std::vector<bool> &byte_enable,
+                                       const ByteEnable &byte_enable,
                                        int &frag_size, int &size_left) const
 {
     bool predicate = true;
@@ -350,12 +350,11 @@ AtomicSimpleCPU::genMemFragmentRequest(const RequestPtr &req, Addr frag_addr,
     size_left -= frag_size;
 
     // Set up byte-enable mask for the current fragment
-    auto it_start = byte_enable.begin() + (size - (frag_size + size_left));
-    auto it_end = byte_enable.begin() + (size - size_left);
-    if (isAnyActiveElement(it_start, it_end)) {
+    unsigned frag_start = size - (frag_size + size_left);
+    if (byte_enable.any(frag_start, frag_size)) {
         req->setVirt(frag_addr, frag_size, flags, dataRequestorId(),
                      inst_addr);
-        req->setByteEnable(std::vector<bool>(it_start, it_end));
+        req->setByteEnable(byte_enable.slice(frag_start, frag_size));
     } else {
         predicate = false;
     }
@@ -366,7 +365,7 @@ AtomicSimpleCPU::genMemFragmentRequest(const RequestPtr &req, Addr frag_addr,
 Fault
 AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
                          Request::Flags flags,
-                         const std::vector<bool> &byte_enable)
+                         const ByteEnable &byte_enable)
 {
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread *thread = t_info.thread;
@@ -444,7 +443,7 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 Fault
 AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                           Request::Flags flags, uint64_t *res,
-                          const std::vector<bool>& byte_enable)
+                          const ByteEnable &byte_enable)
 {
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread *thread = t_info.thread;
@@ -215,12 +215,12 @@ class AtomicSimpleCPU : public BaseSimpleCPU
      */
     bool genMemFragmentRequest(const RequestPtr &req, Addr frag_addr,
                                int size, Request::Flags flags,
-                               const std::vector<bool> &byte_enable,
+                               const ByteEnable &byte_enable,
                                int &frag_size, int &size_left) const;
 
     Fault readMem(Addr addr, uint8_t *data, unsigned size,
                   Request::Flags flags,
-                  const std::vector<bool> &byte_enable=std::vector<bool>())
+                  const ByteEnable &byte_enable=ByteEnable())
         override;
 
     Fault
@@ -240,7 +240,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
     Fault writeMem(uint8_t *data, unsigned size,
                    Addr addr, Request::Flags flags, uint64_t *res,
-                   const std::vector<bool> &byte_enable=std::vector<bool>())
+                   const ByteEnable &byte_enable=ByteEnable())
         override;
 
     Fault amoMem(Addr addr, uint8_t *data, unsigned size,
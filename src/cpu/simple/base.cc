@@ -87,6 +87,7 @@ BaseSimpleCPU::BaseSimpleCPU(const BaseSimpleCPUParams &p)
     : BaseCPU(p),
       curThread(0),
       branchPred(p.branchPred),
+      warmupBranchPred(p.warmupBranchPred),
       traceData(NULL),
       _status(Idle)
 {
@@ -504,6 +505,13 @@ BaseSimpleCPU::advancePC(const Fault &fault)
             ++t_info.execContextStats.numBranchMispred;
         }
     }
+
+    if (warmupBranchPred && fault == NoFault && curStaticInst &&
+        curStaticInst->isControl()) {
+        warmupBranchPred->functionalWarmup(curThread, curStaticInst,
+                                           *preExecuteTempPC,
+                                           thread->pcState());
+    }
 }
 
 RegVal
@@ -86,6 +86,8 @@ class BaseSimpleCPU : public BaseCPU
   protected:
     ThreadID curThread;
     branch_prediction::BPredUnit *branchPred;
+    /** Predictor of a switched out CPU, warmed by this one. */
+    branch_prediction::BPredUnit *warmupBranchPred;
 
     void checkPcEventQueue();
     void swapActiveThread();
@@ -152,14 +154,14 @@ class BaseSimpleCPU : public BaseCPU
 
     virtual Fault
     readMem(Addr addr, uint8_t* data, unsigned size, Request::Flags flags,
-            const std::vector<bool>& byte_enable=std::vector<bool>())
+            const ByteEnable &byte_enable=ByteEnable())
     {
         panic("readMem() is not implemented");
     }
 
     virtual Fault
     initiateMemRead(Addr addr, unsigned size, Request::Flags flags,
-            const std::vector<bool>& byte_enable=std::vector<bool>())
+            const ByteEnable &byte_enable=ByteEnable())
     {
         panic("initiateMemRead() is not implemented\n");
     }
@@ -167,7 +169,7 @@ class BaseSimpleCPU : public BaseCPU
     virtual Fault
     writeMem(uint8_t* data, unsigned size, Addr addr, Request::Flags flags,
             uint64_t* res,
-            const std::vector<bool>& byte_enable=std::vector<bool>())
+            const ByteEnable &byte_enable=ByteEnable())
     {
         panic("writeMem() is not implemented\n");
     }
@@ -406,7 +406,7 @@ class SimpleExecContext : public ExecContext
     Fault
     readMem(Addr addr, uint8_t *data, unsigned int size,
             Request::Flags flags,
-            const std::vector<bool>& byte_enable)
+            const ByteEnable &byte_enable)
         override
     {
         assert(byte_enable.size() == size);
@@ -416,7 +416,7 @@ class SimpleExecContext : public ExecContext
     Fault
     initiateMemRead(Addr addr, unsigned int size,
                     Request::Flags flags,
-                    const std::vector<bool>& byte_enable)
+                    const ByteEnable &byte_enable)
         override
     {
         assert(byte_enable.size() == size);
@@ -426,7 +426,7 @@ class SimpleExecContext : public ExecContext
     Fault
     writeMem(uint8_t *data, unsigned int size, Addr addr,
              Request::Flags flags, uint64_t *res,
-             const std::vector<bool>& byte_enable)
+             const ByteEnable &byte_enable)
         override
     {
         assert(byte_enable.size() == size);
@@ -286,12 +286,12 @@ class TimingSimpleCPU : public BaseSimpleCPU
 
     Fault initiateMemRead(Addr addr, unsigned size,
             Request::Flags flags,
-            const std::vector<bool>& byte_enable =std::vector<bool>())
+            const ByteEnable &byte_enable =ByteEnable())
         override;
 
     Fault writeMem(uint8_t *data, unsigned size,
                    Addr addr, Request::Flags flags, uint64_t *res,
-                   const std::vector<bool>& byte_enable = std::vector<bool>())
+                   const ByteEnable &byte_enable = ByteEnable())
         override;
 
     Fault initiateMemAMO(Addr addr, unsigned size, Request::Flags flags,
@@ -31,11 +31,25 @@
 
 #include <cassert>
 #include <cstring>
+#include <type_traits>
 #include <vector>
 
 namespace gem5
 {
 
+/**
+ * Structs passed through a TimeBuffer may provide a reset() method that
+ * restores the state of a freshly zeroed and constructed struct by only
+ * touching the fields that were used. advance() prefers it over
+ * destroying, zeroing and reconstructing the whole entry.
+ */
+template <class T, class = void>
+struct HasTimeBufferReset : std::false_type {};
+
+template <class T>
+struct HasTimeBufferReset<T, std::void_t<decltype(std::declval<T &>().reset())>>
+    : std::true_type {};
+
 template <class T>
 class TimeBuffer
 {
@@ -184,9 +198,13 @@ class TimeBuffer
         int ptr = base + future;
         if (ptr >= (int)size)
             ptr -= size;
-        (reinterpret_cast<T *>(index[ptr]))->~T();
-        std::memset(index[ptr], 0, sizeof(T));
-        new (index[ptr]) T;
+        if constexpr (HasTimeBufferReset<T>::value) {
+            (reinterpret_cast<T *>(index[ptr]))->reset();
+        } else {
+            (reinterpret_cast<T *>(index[ptr]))->~T();
+            std::memset(index[ptr], 0, sizeof(T));
+            new (index[ptr]) T;
+        }
     }
 
   protected:
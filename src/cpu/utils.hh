@@ -82,18 +82,6 @@ transferNeedsBurst(Addr addr, unsigned int size, unsigned int block_size)
     return (addrBlockOffset(addr, block_size) + size) > block_size;
 }
 
-/**
- * Test if there is any active element in an enablement range.
- */
-inline bool
-isAnyActiveElement(const std::vector<bool>::const_iterator& it_start,
-                   const std::vector<bool>::const_iterator& it_end)
-{
-    auto it_tmp = it_start;
-    for (;it_tmp != it_end && !(*it_tmp); ++it_tmp);
-    return (it_tmp != it_end);
-}
-
 inline std::string
 goldenDiffStr(uint8_t *dut_ptr, uint8_t* golden_ptr, size_t size) {
     assert(size <= 8);
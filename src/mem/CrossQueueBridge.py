@@ -0,0 +1,30 @@
+from m5.params import *
+from m5.SimObject import SimObject
+
+class CrossQueueBridge(SimObject):
+    '''Timing bridge between two event queues that run in parallel. Packets
+       cross through single-producer/single-consumer rings while both sides
+       run, instead of waiting for the quantum barrier as in
+       EventQueueBoundary. The bridge belongs to the memory side queue (its eventq_index).
+       It does not snoop, so it is meant for non-coherent crossings such as
+       the one in front of a memory controller. See the header file for
+       more information.'''
+    type = 'CrossQueueBridge'
+    cxx_header = "mem/cross_queue_bridge.hh"
+    cxx_class = 'gem5::CrossQueueBridge'
+
+    cpu_side_eventq_index = Param.UInt32(
+            "Event queue that owns the objects on the CPU side")
+
+    cpu_side_port = ResponsePort("This port receives requests and "
+                                 "sends responses")
+    mem_side_port = RequestPort("This port sends requests and "
+                                "receives responses")
+
+    req_size = Param.Unsigned(64, "The number of requests to buffer, "
+                              "rounded up to a power of two")
+    resp_size = Param.Unsigned(64, "The number of responses to buffer, "
+                               "rounded up to a power of two")
+    delay = Param.Latency('1ns', "The latency of this bridge; must be at "
+                          "least the simulation quantum when the two sides "
+                          "run on different event queues")
@@ -0,0 +1,25 @@
+from m5.params import *
+from m5.SimObject import SimObject
+
+class EventQueueBoundary(SimObject):
+    '''Connects a port owned by one event queue to a port owned by another
+       when the simulator runs with several event queues in parallel. The
+       boundary itself belongs to the memory side queue (its eventq_index).
+       Timing packets are buffered and cross at the next quantum barrier,
+       where snoops of the crossbar below can reach every core; a single
+       queue run crosses at the same quanta, as a reference for the stats
+       of the parallel run. See the header file for more information.'''
+    type = 'EventQueueBoundary'
+    cxx_header = "mem/eventq_boundary.hh"
+    cxx_class = 'gem5::EventQueueBoundary'
+
+    cpu_side_eventq_index = Param.UInt32(
+            "Event queue that owns the objects on the CPU side")
+
+    cpu_side_port = ResponsePort("This port receives requests and "
+                                 "sends responses")
+    mem_side_port = RequestPort("This port sends requests and "
+                                "receives responses")
+
+    req_size = Param.Unsigned(64, "The number of requests to buffer "
+                              "between two quantum barriers")
@@ -141,8 +141,10 @@ class SnoopFilter(SimObject):
 
     system = Param.System(Parent.any, "System that the crossbar belongs to.")
 
-    # Sanity check on max capacity to track, adjust if needed.
+    # Capacity to track, adjust if needed. Lines are kept in a
+    # set-associative directory of max_capacity / assoc / line size sets.
     max_capacity = Param.MemorySize('8MiB', "Maximum capacity of snoop filter")
+    assoc = Param.Unsigned(16, "Associativity of the snoop filter")
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
@@ -0,0 +1,214 @@
+/**
+ * @file
+ * Fixed-width byte-enable masks for memory requests, packets and the
+ * LSQ, replacing std::vector<bool> so that building, slicing and
+ * testing a mask neither allocates nor walks it bit by bit.
+ */
+
+#ifndef __MEM_BYTE_ENABLE_HH__
+#define __MEM_BYTE_ENABLE_HH__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * A mask of size() bytes kept as 64-bit words, so merges and tests
+ * handle 64 bytes per operation. Masks of up to InlineBytes live in
+ * the object; longer ones, which only occur for unusual block sizes,
+ * fall back to the heap. Bits past size() are always zero.
+ */
+template <unsigned InlineBytes = 64>
+class ByteEnableMask
+{
+  private:
+    static constexpr unsigned WordBits = 64;
+    static constexpr unsigned InlineWords =
+        (InlineBytes + WordBits - 1) / WordBits;
+
+    std::array<uint64_t, InlineWords> inlineWords = {};
+    std::vector<uint64_t> overflow;
+    unsigned _size = 0;
+
+    static unsigned numWords(unsigned size)
+    { return (size + WordBits - 1) / WordBits; }
+
+    unsigned numWords() const { return numWords(_size); }
+
+    uint64_t *
+    words()
+    {
+        return _size > InlineWords * WordBits ? overflow.data() :
+            inlineWords.data();
+    }
+
+    const uint64_t *
+    words() const
+    {
+        return _size > InlineWords * WordBits ? overflow.data() :
+            inlineWords.data();
+    }
+
+    /** Bits [lo, hi) of a word, 0 <= lo < hi <= 64. */
+    static uint64_t
+    wordMask(unsigned lo, unsigned hi)
+    {
+        uint64_t upto = hi == WordBits ? ~0ULL : (1ULL << hi) - 1;
+        return upto & ~((1ULL << lo) - 1);
+    }
+
+    /**
+     * Call op(word, mask) for every word overlapping bytes
+     * [first, first + count), mask selecting the bytes in the range.
+     */
+    template <typename Word, typename Op>
+    static bool
+    forRange(Word *w, unsigned first, unsigned count, Op op)
+    {
+        unsigned end = first + count;
+        for (unsigned i = first / WordBits; first < end; i++) {
+            unsigned base = i * WordBits;
+            unsigned hi = std::min(end - base, WordBits);
+            if (!op(w[i], wordMask(first - base, hi)))
+                return false;
+            first = base + hi;
+        }
+        return true;
+    }
+
+  public:
+    ByteEnableMask() = default;
+
+    /** A mask of size bytes, all enabled or all disabled. */
+    ByteEnableMask(unsigned size, bool enabled)
+    {
+        resize(size);
+        if (enabled)
+            set(0, size, true);
+    }
+
+    /** Resize to size bytes, all disabled. */
+    void
+    resize(unsigned size)
+    {
+        _size = size;
+        if (size > InlineWords * WordBits) {
+            overflow.assign(numWords(size), 0);
+        } else {
+            overflow.clear();
+            inlineWords.fill(0);
+        }
+    }
+
+    unsigned size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    bool
+    operator[](unsigned i) const
+    {
+        assert(i < _size);
+        return (words()[i / WordBits] >> (i % WordBits)) & 1;
+    }
+
+    void
+    set(unsigned i, bool enabled)
+    {
+        set(i, 1, enabled);
+    }
+
+    /** Enable or disable bytes [first, first + count). */
+    void
+    set(unsigned first, unsigned count, bool enabled)
+    {
+        assert(first + count <= _size);
+        forRange(words(), first, count, [enabled](uint64_t &w, uint64_t m)
+        {
+            w = enabled ? w | m : w & ~m;
+            return true;
+        });
+    }
+
+    /** Whether any byte of [first, first + count) is enabled. */
+    bool
+    any(unsigned first, unsigned count) const
+    {
+        assert(first + count <= _size);
+        return !forRange(words(), first, count,
+                         [](uint64_t w, uint64_t m) { return !(w & m); });
+    }
+
+    /** Whether every byte of [first, first + count) is enabled. */
+    bool
+    all(unsigned first, unsigned count) const
+    {
+        assert(first + count <= _size);
+        return forRange(words(), first, count,
+                        [](uint64_t w, uint64_t m) { return (w & m) == m; });
+    }
+
+    bool any() const { return any(0, _size); }
+    bool all() const { return all(0, _size); }
+
+    /** Bytes [first, first + count) as a mask of their own. */
+    ByteEnableMask
+    slice(unsigned first, unsigned count) const
+    {
+        assert(first + count <= _size);
+        ByteEnableMask out;
+        out.resize(count);
+        const uint64_t *src = words();
+        uint64_t *dst = out.words();
+        unsigned shift = first % WordBits;
+        unsigned src_words = numWords();
+        for (unsigned i = 0, j = first / WordBits; i < out.numWords();
+             i++, j++) {
+            uint64_t w = src[j] >> shift;
+            if (shift && j + 1 < src_words)
+                w |= src[j + 1] << (WordBits - shift);
+            dst[i] = w;
+        }
+        if (count % WordBits)
+            dst[out.numWords() - 1] &= wordMask(0, count % WordBits);
+        return out;
+    }
+
+    /** Enable every byte enabled in other, which has the same size. */
+    void
+    merge(const ByteEnableMask &other)
+    {
+        assert(other._size == _size);
+        uint64_t *dst = words();
+        const uint64_t *src = other.words();
+        for (unsigned i = 0; i < numWords(); i++)
+            dst[i] |= src[i];
+    }
+
+    bool
+    operator==(const ByteEnableMask &other) const
+    {
+        return _size == other._size &&
+            std::equal(words(), words() + numWords(), other.words());
+    }
+
+    bool
+    operator!=(const ByteEnableMask &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Byte enables of a single memory access. A cache line fits inline, and
+ * so does the largest RVV access, an 8-field segment or whole-register
+ * group of 8 * VLENB = 128 bytes.
+ */
+using ByteEnable = ByteEnableMask<128>;
+
+} // namespace gem5
+
+#endif // __MEM_BYTE_ENABLE_HH__
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * Ranges, slices and merges of byte-enable masks, inline and on the
+ * heap, against a plain vector of bools.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "mem/byte_enable.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A mask of two words inline, so that 200 bytes go to the heap. */
+using SmallMask = ByteEnableMask<128>;
+
+template <typename Mask>
+std::vector<bool>
+toVector(const Mask &mask)
+{
+    std::vector<bool> out(mask.size());
+    for (unsigned i = 0; i < mask.size(); i++)
+        out[i] = mask[i];
+    return out;
+}
+
+} // anonymous namespace
+
+/** A fresh mask has no byte enabled, even when only partly filled. */
+TEST(ByteEnableTest, NoneSet)
+{
+    for (unsigned size : {0u, 1u, 63u, 64u, 65u, 128u, 200u}) {
+        SmallMask mask(size, false);
+        EXPECT_EQ(mask.size(), size);
+        EXPECT_EQ(mask.empty(), size == 0);
+        EXPECT_FALSE(mask.any());
+        // all() of nothing holds
+        EXPECT_EQ(mask.all(), size == 0);
+        EXPECT_EQ(toVector(mask), std::vector<bool>(size, false));
+    }
+}
+
+/** An all-enabled mask has no stray bits past its size. */
+TEST(ByteEnableTest, AllTrue)
+{
+    for (unsigned size : {1u, 63u, 64u, 65u, 128u, 200u}) {
+        SmallMask mask(size, true);
+        EXPECT_TRUE(mask.all());
+        EXPECT_TRUE(mask.any());
+        EXPECT_EQ(toVector(mask), std::vector<bool>(size, true));
+        EXPECT_EQ(mask, SmallMask(size, true));
+
+        mask.set(size - 1, false);
+        EXPECT_FALSE(mask.all());
+        EXPECT_TRUE(mask.all(0, size - 1));
+        EXPECT_FALSE(mask.any(size - 1, 1));
+    }
+
+    // resizing drops the old bits
+    SmallMask mask(200, true);
+    mask.resize(64);
+    EXPECT_FALSE(mask.any());
+    mask.resize(200);
+    EXPECT_FALSE(mask.any());
+}
+
+/**
+ * set, any and all, which walk their range with forRange, within a
+ * word, up to and across word boundaries, and across the whole mask.
+ */
+TEST(ByteEnableTest, RangesAcrossWords)
+{
+    SmallMask mask(200, false);
+    mask.set(60, 8, true);
+    EXPECT_TRUE(mask.all(60, 8));
+    EXPECT_TRUE(mask.any(0, 61));
+    EXPECT_FALSE(mask.any(0, 60));
+    EXPECT_FALSE(mask.any(68, 132));
+    EXPECT_FALSE(mask.all(59, 9));
+    EXPECT_FALSE(mask.all(60, 9));
+
+    // a range covering three words with whole words in between
+    mask.set(10, 180, true);
+    EXPECT_TRUE(mask.all(10, 180));
+    EXPECT_FALSE(mask.any(0, 10));
+    EXPECT_FALSE(mask.any(190, 10));
+
+    mask.set(64, 64, false);
+    EXPECT_FALSE(mask.any(64, 64));
+    EXPECT_TRUE(mask.all(10, 54));
+    EXPECT_TRUE(mask.all(128, 62));
+    EXPECT_TRUE(mask.any(63, 2));
+    EXPECT_TRUE(mask.any(127, 2));
+
+    // empty ranges
+    EXPECT_FALSE(mask.any(20, 0));
+    EXPECT_TRUE(mask.all(70, 0));
+}
+
+/** Slices at every offset and length match the bytes they cover. */
+TEST(ByteEnableTest, Slice)
+{
+    std::mt19937 rng(1);
+    for (unsigned size : {64u, 128u, 200u}) {
+        SmallMask mask(size, false);
+        std::vector<bool> ref(size);
+        for (unsigned i = 0; i < size; i++) {
+            ref[i] = rng() % 3 == 0;
+            mask.set(i, ref[i]);
+        }
+        ASSERT_EQ(toVector(mask), ref);
+
+        for (unsigned first = 0; first < size; first++) {
+            for (unsigned count = 0; first + count <= size; count++) {
+                const SmallMask slice = mask.slice(first, count);
+                ASSERT_EQ(toVector(slice),
+                          std::vector<bool>(ref.begin() + first,
+                                            ref.begin() + first + count))
+                    << "size " << size << " first " << first
+                    << " count " << count;
+            }
+        }
+    }
+
+    // no bits past the slice are kept, so slices compare equal
+    SmallMask mask(128, true);
+    EXPECT_EQ(mask.slice(3, 70), SmallMask(70, true));
+    EXPECT_TRUE(mask.slice(70, 58).all());
+}
+
+/** Merging enables the union of the bytes, inline and on the heap. */
+TEST(ByteEnableTest, Merge)
+{
+    for (unsigned size : {100u, 200u}) {
+        SmallMask a(size, false), b(size, false);
+        a.set(0, 50, true);
+        b.set(40, size - 40, true);
+        EXPECT_NE(a, b);
+        a.merge(b);
+        EXPECT_TRUE(a.all());
+        EXPECT_EQ(a, SmallMask(size, true));
+    }
+}
@@ -45,6 +45,9 @@
 
 #include "mem/cache/base.hh"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/output.hh"
@@ -111,6 +114,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       tags(p.tags),
       compressor(p.compressor),
       prefetcher(p.prefetcher),
+      replacementPolicy(p.replacement_policy),
       writeAllocator(p.write_allocator),
       indexWayPreTable(p.way_entries,p.way_entries,p.way_indexing_policy,
           p.way_replacement_policy,waypreEntry()),
@@ -262,6 +266,84 @@ BaseCache::init()
     forwardSnoops = cpuSidePort.isSnooping();
 }
 
+std::string
+BaseCache::warmStateGeometry() const
+{
+    const auto &tags_params =
+        static_cast<const BaseTagsParams &>(tags->params());
+    return csprintf("size=%d assoc=%d blk=%d tags=%s indexing=%s repl=%s",
+                    size, assoc, blkSize, WarmStateful::typeName(*tags),
+                    WarmStateful::typeName(*tags_params.indexing_policy),
+                    WarmStateful::typeName(*replacementPolicy));
+}
+
+void
+BaseCache::saveWarmState(WarmStateOut &out) const
+{
+    std::vector<std::pair<Tick, const CacheBlk *>> blks;
+    tags->forEachBlk([this, &blks](CacheBlk &blk) {
+        if (!blk.isValid())
+            return;
+        // the fully associative tags keep their own LRU order instead
+        Tick tick = blk.replacementData ?
+            replacementPolicy->warmStateTick(blk.replacementData) : 0;
+        blks.emplace_back(tick, &blk);
+    });
+    // replaying the least recently used first keeps their order even
+    // where the replacement data is not restored
+    std::stable_sort(blks.begin(), blks.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    out.put<uint64_t>(blks.size());
+    for (const auto &[tick, blk] : blks) {
+        out.put<Addr>(tags->regenerateBlkAddr(blk));
+        out.put<bool>(blk->isSecure());
+        out.put<Tick>(tick);
+        WarmStateOut repl;
+        if (blk->replacementData)
+            replacementPolicy->saveWarmState(blk->replacementData, repl);
+        out.putString(repl.data());
+    }
+}
+
+void
+BaseCache::loadWarmState(WarmStateIn &in)
+{
+    // the blocks replayed by the inner levels are the next victims
+    tags->forEachBlk([this](CacheBlk &blk) {
+        if (blk.isValid() && blk.replacementData)
+            replacementPolicy->invalidate(blk.replacementData);
+    });
+
+    // last saved tick and its rank, per set
+    std::unordered_map<uint32_t, std::pair<Tick, Tick>> ranks;
+    const std::string section = name();
+    uint64_t num_blks = in.get<uint64_t>();
+    for (uint64_t i = 0; i < num_blks; i++) {
+        Addr addr = in.get<Addr>();
+        bool is_secure = in.get<bool>();
+        Tick tick = in.get<Tick>();
+        std::string repl_data = in.getString();
+
+        RequestPtr req = std::make_shared<Request>(addr, blkSize,
+            is_secure ? Request::SECURE : 0, Request::funcRequestorId);
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.allocate();
+        recvAtomic(&pkt);
+
+        CacheBlk *blk = tags->findBlock(addr, is_secure);
+        if (!blk || !blk->replacementData)
+            continue;
+        auto &[last_tick, rank] = ranks[blk->getSet()];
+        if (rank == 0 || tick != last_tick) {
+            last_tick = tick;
+            rank++;
+        }
+        WarmStateIn repl(section, repl_data);
+        replacementPolicy->loadWarmState(blk->replacementData, repl, rank);
+    }
+}
+
 Port &
 BaseCache::getPort(const std::string &if_name, PortID idx)
 {
@@ -79,6 +79,7 @@
 #include "sim/serialize.hh"
 #include "sim/sim_exit.hh"
 #include "sim/system.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -96,7 +97,7 @@ struct BaseCacheParams;
 /**
  * A basic cache interface. Implements some common functions for speed.
  */
-class BaseCache : public ClockedObject, CacheAccessor
+class BaseCache : public ClockedObject, CacheAccessor, public WarmStateful
 {
   protected:
     /**
@@ -375,6 +376,9 @@ class BaseCache : public ClockedObject, CacheAccessor
     /** Prefetcher */
     prefetch::Base *prefetcher;
 
+    /** Replacement policy of the tags, for the warm state. */
+    replacement_policy::Base *replacementPolicy;
+
     /** To probe when a cache hit occurs */
     ProbePointArg<PacketPtr> *ppHit;
 
@@ -1063,20 +1067,20 @@ class BaseCache : public ClockedObject, CacheAccessor
 
         /** Number of hits per thread for each type of command.
             @sa Packet::Command */
-        statistics::Vector hits;
+        statistics::BankedVector hits;
         /** Number of misses per thread for each type of command.
             @sa Packet::Command */
-        statistics::Vector misses;
+        statistics::BankedVector misses;
         /**
          * Total number of ticks per thread/command spent waiting for a hit.
          * Used to calculate the average hit latency.
          */
-        statistics::Vector hitLatency;
+        statistics::BankedVector hitLatency;
         /**
          * Total number of ticks per thread/command spent waiting for a miss.
          * Used to calculate the average miss latency.
          */
-        statistics::Vector missLatency;
+        statistics::BankedVector missLatency;
         statistics::Distribution missLatencyDist;
 
         /** The number of accesses per command and thread. */
@@ -1086,15 +1090,15 @@ class BaseCache : public ClockedObject, CacheAccessor
         /** The average miss latency per command and thread. */
         statistics::Formula avgMissLatency;
         /** Number of misses that hit in the MSHRs per command and thread. */
-        statistics::Vector mshrHits;
+        statistics::BankedVector mshrHits;
         /** Number of misses that miss in the MSHRs, per command and thread. */
-        statistics::Vector mshrMisses;
+        statistics::BankedVector mshrMisses;
         /** Number of misses that miss in the MSHRs, per command and thread. */
-        statistics::Vector mshrUncacheable;
+        statistics::BankedVector mshrUncacheable;
         /** Total tick latency of each MSHR miss, per command and thread. */
-        statistics::Vector mshrMissLatency;
+        statistics::BankedVector mshrMissLatency;
         /** Total tick latency of each MSHR miss, per command and thread. */
-        statistics::Vector mshrUncacheableLatency;
+        statistics::BankedVector mshrUncacheableLatency;
         /** The miss rate in the MSHRs pre command and thread. */
         statistics::Formula mshrMissRate;
         /** The average latency of an MSHR miss, per command and thread. */
@@ -1244,6 +1248,30 @@ class BaseCache : public ClockedObject, CacheAccessor
 
     void init() override;
 
+    std::string warmStateName() const override { return name(); }
+    std::string warmStateGeometry() const override;
+
+    /**
+     * Saves the valid blocks with their replacement data, least recently
+     * used first.
+     */
+    void saveWarmState(WarmStateOut &out) const override;
+
+    /**
+     * Replays the saved blocks as clean atomic reads, which refills the
+     * levels below as well and keeps the snoop filters consistent, then
+     * restores their replacement data. The blocks the inner levels
+     * replayed into this one are made the next victims first. Dirty
+     * state is not restored.
+     */
+    void loadWarmState(WarmStateIn &in) override;
+
+    /**
+     * Inner levels first: their replays pass through the outer levels,
+     * which then put their own blocks back on top.
+     */
+    int warmStateOrder() const override { return cacheLevel; }
+
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
@@ -856,6 +856,9 @@ class XSCompositePrefetcher(QueuedPrefetcher):
     type = "XSCompositePrefetcher"
     cxx_class = 'gem5::prefetch::XSCompositePrefetcher'
     cxx_header = 'mem/cache/prefetch/sms.hh'
+    cxx_exports = [
+        PyBindMethod("setComponentEnabled"),
+    ]
 
     use_virtual_addresses = True
     prefetch_on_pf_hit = True
@@ -32,6 +32,7 @@
 #include "mem/cache/replacement_policies/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/cache/tags/tagged_entry.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -122,6 +123,30 @@ class AssociativeSet
      */
     void invalidate(Entry* entry);
 
+    /** Sizes and policies, for the geometry of a warm state section. */
+    std::string warmStateGeometry() const;
+
+    /**
+     * Save every entry to a warm state snapshot: whether it is valid, its
+     * tag, the rank of its recency in its set and its replacement data,
+     * then the fields of the valid ones through save_entry.
+     *
+     * @param out Section of the owner of the container.
+     * @param save_entry Called with each valid entry and out.
+     */
+    template <typename SaveEntry>
+    void saveWarmState(WarmStateOut &out, SaveEntry save_entry) const;
+
+    /**
+     * Restore every entry in place from a snapshot written by
+     * saveWarmState, which has the same geometry.
+     *
+     * @param in Section of the owner of the container.
+     * @param load_entry Called with each restored entry and in.
+     */
+    template <typename LoadEntry>
+    void loadWarmState(WarmStateIn &in, LoadEntry load_entry);
+
     /** Iterator types */
     using const_iterator = typename std::vector<Entry>::const_iterator;
     using iterator = typename std::vector<Entry>::iterator;
@@ -29,6 +29,11 @@
 #ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
 #define __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "base/cprintf.hh"
 #include "base/intmath.hh"
 #include "mem/cache/prefetch/associative_set.hh"
 
@@ -125,6 +130,69 @@ AssociativeSet<Entry>::invalidate(Entry* entry)
     replacementPolicy->invalidate(entry->replacementData);
 }
 
+template<class Entry>
+std::string
+AssociativeSet<Entry>::warmStateGeometry() const
+{
+    return csprintf("%d/%d %s %s", numEntries, associativity,
+                    WarmStateful::typeName(*indexingPolicy),
+                    WarmStateful::typeName(*replacementPolicy));
+}
+
+template<class Entry>
+template <typename SaveEntry>
+void
+AssociativeSet<Entry>::saveWarmState(WarmStateOut &out,
+                                     SaveEntry save_entry) const
+{
+    // distinct ticks of the valid entries of each set, in order
+    std::map<uint32_t, std::vector<Tick>> set_ticks;
+    for (const auto &entry : entries) {
+        if (entry.isValid()) {
+            set_ticks[entry.getSet()].push_back(
+                replacementPolicy->warmStateTick(entry.replacementData));
+        }
+    }
+    for (auto &[set, ticks] : set_ticks) {
+        std::sort(ticks.begin(), ticks.end());
+        ticks.erase(std::unique(ticks.begin(), ticks.end()), ticks.end());
+    }
+
+    for (const auto &entry : entries) {
+        out.put<bool>(entry.isValid());
+        if (!entry.isValid())
+            continue;
+        const std::vector<Tick> &ticks = set_ticks[entry.getSet()];
+        const Tick tick =
+            replacementPolicy->warmStateTick(entry.replacementData);
+        out.put<Addr>(entry.getTag());
+        out.put<bool>(entry.isSecure());
+        out.put<Tick>(std::lower_bound(ticks.begin(), ticks.end(), tick) -
+                      ticks.begin() + 1);
+        replacementPolicy->saveWarmState(entry.replacementData, out);
+        save_entry(entry, out);
+    }
+}
+
+template<class Entry>
+template <typename LoadEntry>
+void
+AssociativeSet<Entry>::loadWarmState(WarmStateIn &in, LoadEntry load_entry)
+{
+    for (auto &entry : entries) {
+        invalidate(&entry);
+        if (!in.get<bool>())
+            continue;
+        const Addr tag = in.get<Addr>();
+        const bool is_secure = in.get<bool>();
+        const Tick rank = in.get<Tick>();
+        entry.insert(tag, is_secure);
+        replacementPolicy->reset(entry.replacementData);
+        replacementPolicy->loadWarmState(entry.replacementData, in, rank);
+        load_entry(entry, in);
+    }
+}
+
 } // namespace gem5
 
 #endif//__CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
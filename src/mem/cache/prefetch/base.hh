@@ -47,9 +47,11 @@
 #define __MEM_CACHE_PREFETCH_BASE_HH__
 
 #include <cstdint>
+#include <limits>
 
 #include "arch/generic/tlb.hh"
 #include "base/compiler.hh"
+#include "base/sat_counter.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_probe_arg.hh"
@@ -59,6 +61,7 @@
 #include "sim/byteswap.hh"
 #include "sim/clocked_object.hh"
 #include "sim/probe/probe.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -69,7 +72,7 @@ GEM5_DEPRECATED_NAMESPACE(Prefetcher, prefetch);
 namespace prefetch
 {
 
-class Base : public ClockedObject
+class Base : public ClockedObject, public WarmStateful
 {
     class PrefetchListener : public ProbeListenerArgBase<PacketPtr>
     {
@@ -578,6 +581,44 @@ class Base : public ClockedObject
     virtual void offloadToDownStream() { panic("offloadToDownStream() not implemented"); }
 
     virtual bool hasHintsWaiting() { return false; }
+
+    std::string warmStateName() const override { return name(); }
+
+    /** The prefetcher type, followed by the sizes of its saved tables. */
+    std::string
+    warmStateGeometry() const override
+    {
+        return WarmStateful::typeName(*this);
+    }
+
+    /** Nothing by default: prefetchers saving no tables start cold. */
+    void saveWarmState(WarmStateOut &out) const override {}
+    void loadWarmState(WarmStateIn &in) override {}
+
+    /** After all the caches, whose replays train the prefetchers. */
+    int
+    warmStateOrder() const override
+    {
+        return std::numeric_limits<int>::max();
+    }
+
+  protected:
+    /** Save a saturating counter to a warm state section. */
+    template <typename T>
+    static void
+    saveCounter(WarmStateOut &out, const GenericSatCounter<T> &counter)
+    {
+        out.put<T>(counter);
+    }
+
+    /** Restore a saturating counter, saturating at its own width. */
+    template <typename T>
+    static void
+    loadCounter(WarmStateIn &in, GenericSatCounter<T> &counter)
+    {
+        counter -= T(counter);
+        counter += in.get<T>();
+    }
 };
 
 } // namespace prefetch
@@ -282,7 +282,7 @@ BertiPrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::vecto
         int64_t blk_delta = (int64_t)blockIndex(addr) - blockIndex(pfi.getAddr());
         topDeltas[blk_delta] = topDeltas.count(blk_delta) ? topDeltas[blk_delta] + 1 : 1;
         DPRINTF(BertiPrefetcher, "Send pf: %lx\n", addr);
-        filter->insert(addr, 0);
+        filter->insert(addr);
         addresses.push_back(AddrPriority(addr, prio, src));
         return true;
     }
@@ -14,6 +14,7 @@
 #include "base/types.hh"
 #include "debug/BertiPrefetcher.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/BertiPrefetcher.hh"
@@ -165,7 +166,7 @@ class BertiPrefetcher : public Queued
 
   public:
 
-    boost::compute::detail::lru_cache<Addr, Addr> *filter;
+    PrefetchFilter *filter;
 
     BertiPrefetcher(const BertiPrefetcherParams &p);
 
@@ -38,10 +38,10 @@
 
 #include <queue>
 #include <set>
-#include <boost/compute/detail/lru_cache.hpp>
 
 #include "base/sat_counter.hh"
 #include "base/statistics.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 
@@ -220,7 +220,7 @@ class BOP : public Queued
         } stats;
 
     public:
-        boost::compute::detail::lru_cache<Addr, Addr> *filter;
+        PrefetchFilter *filter;
 
         /** Update the RR right table after a prefetch fill */
         void notifyFill(const PacketPtr& pkt) override;
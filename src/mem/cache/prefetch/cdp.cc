@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <queue>
 
+#include "base/bitfield.hh"
 #include "base/stats/group.hh"
 #include "base/trace.hh"
 #include "debug/CDPUseful.hh"
@@ -65,7 +66,10 @@ CDP::CDP(const CDPParams &p)
         enable_prf_filter.push_back(false);
     }
     prefetchStatsPtr = &prefetchStats;
-    pfLRUFilter = new boost::compute::detail::lru_cache<Addr, Addr>(128);
+    if (!p.is_sub_prefetcher) {
+        ownPfFilter = std::make_unique<PrefetchFilter>(this, "pfFilter", 128);
+        pfLRUFilter = ownPfFilter.get();
+    }
 }
 
 CDP::CDPStats::CDPStats(statistics::Group *parent)
@@ -230,29 +234,18 @@ CDP::notifyWithData(const PacketPtr &pkt, bool is_l1_use, std::vector<AddrPriori
             }
         }
         unsigned sentCount = 0;
-        for (int of = 0; of < max_offset; of++) {
+        uint64_t align_mask = mask(2);
+        if (trueAccuracy < 0.05) {
+            align_mask = mask(11);
+        }
+        uint64_t candidates = pointerCandidates(addrs.data(), max_offset, align_mask);
+        for (; candidates != 0; candidates &= candidates - 1) {
+            int of = ctz64(candidates);
             test_addr = addrs[of];
-            int align_bit = BITS(test_addr, 1, 0);
-            if (trueAccuracy < 0.05) {
-                align_bit = BITS(test_addr, 10, 0);
-            } else if (trueAccuracy < 0.01) {
-                align_bit = BITS(test_addr, 11, 0);
-            }
-            int filter_bit = BITS(test_addr, 5, 0);
-            int page_offset, vpn0, vpn1, vpn1_addr, vpn2, vpn2_addr, check_bit;
-            check_bit = BITS(test_addr, 63, 39);
-            vpn2 = BITS(test_addr, 38, 30);
-            vpn2_addr = BITS(pkt->req->getVaddr(), 38, 30);
-            vpn1 = BITS(test_addr, 29, 21);
-            vpn1_addr = BITS(pkt->req->getVaddr(), 29, 21);
-            vpn0 = BITS(test_addr, 20, 12);
-            page_offset = BITS(test_addr, 11, 0);
-            bool flag = true;
-            if ((check_bit != 0) || (vpn0 == 0) || (align_bit != 0) || (!vpnTable.search(vpn2, vpn1))) {
-                flag = false;
-            }
+            int vpn1 = BITS(test_addr, 29, 21);
+            int vpn2 = BITS(test_addr, 38, 30);
             Addr test_addr2 = Addr(test_addr);
-            if (flag) {
+            if (vpnTable.search(vpn2, vpn1)) {
                 if (pf_depth >= depth_threshold) {
                     cdpStats.dataNotifyExitDepth++;
                     return;
@@ -308,7 +301,7 @@ CDP::sendPFWithFilter(Addr addr, std::vector<AddrPriority> &addresses, int prio,
     if (pfLRUFilter->contains((addr))) {
         return false;
     } else {
-        pfLRUFilter->insert((addr), 0);
+        pfLRUFilter->insert(addr);
         AddrPriority addr_prio = AddrPriority(addr, prio, pfSource);
         addr_prio.depth = pf_depth;
         addresses.push_back(addr_prio);
@@ -318,6 +311,33 @@ CDP::sendPFWithFilter(Addr addr, std::vector<AddrPriority> &addresses, int prio,
     return false;
 }
 
+uint64_t
+CDP::pointerCandidates(const uint64_t *words, unsigned num_words, uint64_t align_mask)
+{
+    assert(num_words <= 64);
+    uint64_t candidates = 0;
+    for (unsigned of = 0; of < num_words; of++) {
+        uint64_t word = words[of];
+        bool valid = ((word >> 39) == 0) & (BITS(word, 20, 12) != 0) & ((word & align_mask) == 0);
+        candidates |= uint64_t(valid) << of;
+    }
+    return candidates;
+}
+
+std::vector<Addr>
+CDP::scanPointer(Addr addr, const std::vector<uint64_t> &addrs)
+{
+    std::vector<Addr> ans;
+    uint64_t candidates = pointerCandidates(addrs.data(), addrs.size(), mask(2));
+    for (; candidates != 0; candidates &= candidates - 1) {
+        Addr test_addr = addrs[ctz64(candidates)];
+        if (vpnTable.search(BITS(test_addr, 38, 30), BITS(test_addr, 29, 21))) {
+            ans.push_back(test_addr);
+        }
+    }
+    return ans;
+}
+
 void
 CDP::addToVpnTable(Addr addr)
 {
@@ -39,17 +39,19 @@
 
 #define BITMASK(bits) ((1ull << (bits)) - 1)
 #define BITS(x, hi, lo) (((x) >> (lo)) & BITMASK((hi) - (lo) + 1))
+#include <cassert>
+#include <cstdint>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
-#include <boost/compute/detail/lru_cache.hpp>
-
 #include "base/sat_counter.hh"
 #include "base/types.hh"
 #include "mem/cache/base.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/CDP.hh"
@@ -80,35 +82,99 @@ class CDP : public Queued
     /** Byte order used to access the cache */
     /** Update the RR right table after a prefetch fill */
 
+    /**
+     * Tracks which 2MB regions (vpn2, vpn1) are hot. Accesses are counted
+     * in an epoch table; every 128 accesses the regions above the
+     * threshold are promoted into the hot table and the epoch table ages
+     * out. Both levels are fixed-size open-addressing tables, since an
+     * epoch can never touch more than 128 distinct regions.
+     */
     class VpnTable
     {
       public:
-        std::map<int, std::map<int, int>> vpns;
-        std::map<int, std::map<int, int>> hotVpns;
+        static constexpr int EpochLength = 128;
+        static constexpr unsigned TableBits = 8;
+        static constexpr unsigned TableSize = 1 << TableBits;
+        static_assert(TableSize >= 2 * EpochLength, "table may fill up");
+
+      private:
+        static constexpr uint32_t InvalidKey = ~0U;
+
+        struct Slot
+        {
+            uint32_t key;
+            int count;
+        };
+
+        struct Table
+        {
+            Slot slots[TableSize];
+            /** Occupied slot indices, to age the table in O(used) */
+            uint16_t used[TableSize];
+            unsigned numUsed{0};
+
+            Table() { for (auto &slot : slots) slot.key = InvalidKey; }
+
+            Slot *
+            find(uint32_t key)
+            {
+                for (unsigned i = hash(key);; i = (i + 1) % TableSize) {
+                    if (slots[i].key == key) {
+                        return &slots[i];
+                    }
+                    if (slots[i].key == InvalidKey) {
+                        return nullptr;
+                    }
+                }
+            }
+
+            Slot &
+            findOrInsert(uint32_t key)
+            {
+                unsigned i = hash(key);
+                for (; slots[i].key != InvalidKey; i = (i + 1) % TableSize) {
+                    if (slots[i].key == key) {
+                        return slots[i];
+                    }
+                }
+                assert(numUsed < TableSize);
+                used[numUsed++] = i;
+                slots[i] = {key, 0};
+                return slots[i];
+            }
+
+            void
+            clear()
+            {
+                for (unsigned i = 0; i < numUsed; i++) {
+                    slots[used[i]].key = InvalidKey;
+                }
+                numUsed = 0;
+            }
+        };
+
+        static uint32_t makeKey(int vpn2, int vpn1) { return (uint32_t(vpn2) << 9) | uint32_t(vpn1); }
+        static unsigned hash(uint32_t key) { return (key * 0x9e3779b1U) >> (32 - TableBits); }
+
+        Table vpns;
+        Table hotVpns;
+
+      public:
         int counter{0};
         void add(int vpn2, int vpn1)
         {
             counter++;
-            if (vpns.find(vpn2) == vpns.end()) {
-                std::map<int, int> sub_map;
-                sub_map[vpn1] = 1;
-                vpns[vpn2] = sub_map;
-            } else if (vpns[vpn2].find(vpn1) == vpns[vpn2].end()) {
-                vpns[vpn2][vpn1] = 1;
-            } else {
-                vpns[vpn2][vpn1] += 1;
-            }
+            vpns.findOrInsert(makeKey(vpn2, vpn1)).count++;
         }
         void resetConfidence(float throttle_aggressiveness, bool enable_thro)
         {
-            if (counter < 128)
+            if (counter < EpochLength)
                 return;
             hotVpns.clear();
-            for (auto pair2 : vpns) {
-                for (auto pair1 : pair2.second) {
-                    if (pair1.second > counter / 16 || enable_thro) {
-                        hotVpns[pair2.first][pair1.first] = pair1.second * throttle_aggressiveness;
-                    }
+            for (unsigned i = 0; i < vpns.numUsed; i++) {
+                const Slot &slot = vpns.slots[vpns.used[i]];
+                if (slot.count > counter / 16 || enable_thro) {
+                    hotVpns.findOrInsert(slot.key).count = slot.count * throttle_aggressiveness;
                 }
             }
             counter = 0;
@@ -116,17 +182,16 @@ class CDP : public Queued
         }
         bool search(int vpn2, int vpn1)
         {
-            if (hotVpns.find(vpn2) != hotVpns.end() && hotVpns[vpn2].find(vpn1) != hotVpns[vpn2].end()) {
-                if (hotVpns[vpn2][vpn1] > 0) {
-                    return true;
-                }
-            }
-            return false;
+            Slot *slot = hotVpns.find(makeKey(vpn2, vpn1));
+            return slot && slot->count > 0;
         }
         void update(int vpn2, int vpn1, bool enable_thro)
         {
             if (enable_thro) {
-                hotVpns[vpn2][vpn1]--;
+                Slot *slot = hotVpns.find(makeKey(vpn2, vpn1));
+                if (slot) {
+                    slot->count--;
+                }
             }
         }
         VpnTable() { resetConfidence(2, false); }
@@ -149,13 +214,6 @@ class CDP : public Queued
 
     CDP(const CDPParams &p);
 
-    ~CDP()
-    {
-        // Delete the pfLRUFilter pointer to release memory
-        Queued::~Queued();
-        delete pfLRUFilter;
-    }
-
     ByteOrder byteOrder;
 
     using Queued::notifyFill;
@@ -171,34 +229,23 @@ class CDP : public Queued
 
     void addToVpnTable(Addr vaddr);
 
-    std::vector<Addr> scanPointer(Addr addr, std::vector<uint64_t> addrs)
-    {
-        uint64_t test_addr;
-        std::vector<Addr> ans;
-        for (int of = 0; of < 8; of++) {
-            test_addr = addrs[of];
-            int align_bit = BITS(test_addr, 1, 0);
-            int filter_bit = BITS(test_addr, 5, 0);
-            int page_offset, vpn0, vpn1, vpn2, check_bit;
-            check_bit = BITS(test_addr, 63, 39);
-            vpn2 = BITS(test_addr, 38, 30);
-            vpn1 = BITS(test_addr, 29, 21);
-            vpn0 = BITS(test_addr, 20, 12);
-            page_offset = BITS(test_addr, 11, 0);
-            bool flag = true;
-            if ((check_bit != 0) || (!vpnTable.search(vpn2, vpn1)) || (vpn0 == 0) || (align_bit != 0)) {
-                flag = false;
-            }
-            Addr test_addr2 = Addr(test_addr);
-            if (flag) {
-                ans.push_back(test_addr2);
-            }
-        }
-        return ans;
-    };
+    /**
+     * Range-check the words of a line for Sv39 user pointers: upper bits
+     * clear, vpn0 nonzero and the low bits in align_mask clear. The checks
+     * are branch-free so the compiler vectorizes them over the line.
+     * @return Bitmask of the words that may point into a hot region.
+     */
+    static uint64_t pointerCandidates(const uint64_t *words, unsigned num_words, uint64_t align_mask);
+
+    std::vector<Addr> scanPointer(Addr addr, const std::vector<uint64_t> &addrs);
 
 
-    boost::compute::detail::lru_cache<Addr, Addr> *pfLRUFilter;
+    /**
+     * Filter of CDP when it runs alone. As a sub-prefetcher it uses the
+     * one of its composite, which sets pfLRUFilter.
+     */
+    std::unique_ptr<PrefetchFilter> ownPfFilter;
+    PrefetchFilter *pfLRUFilter = nullptr;
     std::list<DeferredPacket> localBuffer;
     unsigned depth{4};
 
@@ -277,7 +277,7 @@ CMCPrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::vector<
         return false;
     } else {
         DPRINTF(CMCPrefetcher, "CMC: send pf: %lx\n", addr);
-        filter->insert(addr, 0);
+        filter->insert(addr);
         addresses.push_back(AddrPriority(addr, prio, src));
         return true;
     }
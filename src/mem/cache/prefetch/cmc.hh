@@ -2,11 +2,11 @@
 #define GEM5_NEXTLINE_HH
 
 #include <boost/circular_buffer.hpp>
-#include <boost/compute/detail/lru_cache.hpp>
 
 #include "base/types.hh"
 #include "cpu/pred/general_arch_db.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/cache/tags/indexing_policies/set_associative.hh"
@@ -80,7 +80,7 @@ class CMCPrefetcher : public Queued
         panic("not implemented");
     };
 
-    boost::compute::detail::lru_cache<Addr, Addr> *filter;
+    PrefetchFilter *filter;
 
     void doPrefetch(const PrefetchInfo &pfi, std::vector<AddrPriority> &addresses, bool late,
                            PrefetchSourceType pf_source, bool is_first_shot);
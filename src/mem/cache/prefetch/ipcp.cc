@@ -22,8 +22,9 @@ IPCP::IPCP(const IPCPrefetcherParams &p)
 {
     assert((ipt_size & (ipt_size - 1)) == 0);
     assert((cspt_size & (cspt_size - 1)) == 0);
-    if (p.use_rrf) {
-        rrf = new boost::compute::detail::lru_cache<Addr, Addr>(32);
+    if (p.use_rrf && !p.is_sub_prefetcher) {
+        ownRrf = std::make_unique<PrefetchFilter>(this, "rrf", 32);
+        rrf = ownRrf.get();
     }
 
     ipt.resize(ipt_size);
@@ -62,7 +63,7 @@ IPCP::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::vector<AddrPrior
         ipcpStats.pf_filtered++;
         return false;
     } else {
-        rrf->insert(addr, 0);
+        rrf->insert(addr);
         addresses.push_back(AddrPriority(addr, prio, pfSource));
         return true;
     }
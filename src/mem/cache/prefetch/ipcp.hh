@@ -1,14 +1,14 @@
 #ifndef __MEM_CACHE_PREFETCH_IPCP_HH__
 #define __MEM_CACHE_PREFETCH_IPCP_HH__
 
+#include <memory>
 #include <vector>
 
-#include <boost/compute/detail/lru_cache.hpp>
-
 #include "base/compiler.hh"
 #include "base/sat_counter.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/cache/prefetch/signature_path.hh"
 #include "mem/cache/prefetch/stride.hh"
@@ -105,8 +105,10 @@ class IPCP : public Queued
     Classifier saved_type;
     int saved_stride;
 
-    // prefetch filter (32RR filter)
-    boost::compute::detail::lru_cache<Addr, Addr> *rrf = nullptr;
+    // prefetch filter (32RR filter), the one of the composite prefetcher
+    // when IPCP is a sub-prefetcher
+    std::unique_ptr<PrefetchFilter> ownRrf;
+    PrefetchFilter *rrf = nullptr;
 
     IPCP(const IPCPrefetcherParams &p);
 
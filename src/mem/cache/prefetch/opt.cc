@@ -223,7 +223,7 @@ OptPrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::vector<
         return false;
     } else {
         DPRINTF(OptPrefetcher, "Send pf: %lx\n", addr);
-        filter->insert(addr, 0);
+        filter->insert(addr);
         if (ahead_level > 1) {
             assert(ahead_level == 2 || ahead_level == 3);
             addresses.back().pfahead_host = ahead_level;
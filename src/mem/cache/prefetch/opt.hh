@@ -4,13 +4,12 @@
 #include <unordered_map>
 #include <vector>
 
-#include <boost/compute/detail/lru_cache.hpp>
-
 #include "base/sat_counter.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "debug/OptPrefetcher.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/OptPrefetcher.hh"
@@ -76,7 +75,7 @@ class OptPrefetcher : public Queued
                             PrefetchSourceType src, int ahead_level);
 
     public:
-      boost::compute::detail::lru_cache<Addr, Addr> *filter;
+      PrefetchFilter *filter;
       OptPrefetcher(const OptPrefetcherParams &p);
 
       using Queued::calculatePrefetch;
@@ -0,0 +1,117 @@
+#include "mem/cache/prefetch/prefetch_filter.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Prefetcher, prefetch);
+namespace prefetch
+{
+
+PrefetchFilter::PrefetchFilter(statistics::Group *parent,
+                               const std::string &name, unsigned capacity)
+    : statistics::Group(parent, name.c_str()),
+      capacity(capacity),
+      entries(capacity, 0),
+      // about 16 counters per address keeps false positives low
+      bloomBits(ceilLog2(std::max(capacity, 1U)) + 4),
+      bloom(1ULL << bloomBits, 0),
+      stats(this)
+{
+    fatal_if(capacity == 0, "Prefetch filter %s needs at least one entry",
+             name);
+}
+
+void
+PrefetchFilter::bloomIndices(Addr addr, unsigned (&idx)[NumHashes]) const
+{
+    uint64_t h = addr * 0x9e3779b97f4a7c15ULL;
+    idx[0] = h >> (64 - bloomBits);
+    idx[1] = (h >> (32 - bloomBits)) & mask(bloomBits);
+}
+
+bool
+PrefetchFilter::camContains(Addr addr) const
+{
+    // All valid entries are packed at the front until the first wrap, and
+    // the array is full afterwards, so a flat scan covers exactly them.
+    for (unsigned i = 0; i < count; i++) {
+        if (entries[i] == addr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+PrefetchFilter::contains(Addr addr)
+{
+    stats.lookups++;
+    unsigned idx[NumHashes];
+    bloomIndices(addr, idx);
+    for (unsigned i = 0; i < NumHashes; i++) {
+        if (bloom[idx[i]] == 0) {
+            stats.bloomRejects++;
+            return false;
+        }
+    }
+    if (camContains(addr)) {
+        stats.redundant++;
+        return true;
+    }
+    return false;
+}
+
+void
+PrefetchFilter::insert(Addr addr)
+{
+    if (camContains(addr)) {
+        return;
+    }
+
+    unsigned idx[NumHashes];
+    unsigned slot;
+    if (count < capacity) {
+        slot = count++;
+    } else {
+        slot = head;
+        head = (head + 1) % capacity;
+        bloomIndices(entries[slot], idx);
+        for (unsigned i = 0; i < NumHashes; i++) {
+            assert(bloom[idx[i]] > 0);
+            bloom[idx[i]]--;
+        }
+    }
+
+    entries[slot] = addr;
+    bloomIndices(addr, idx);
+    for (unsigned i = 0; i < NumHashes; i++) {
+        bloom[idx[i]]++;
+    }
+}
+
+void
+PrefetchFilter::clear()
+{
+    head = 0;
+    count = 0;
+    std::fill(bloom.begin(), bloom.end(), 0);
+}
+
+PrefetchFilter::FilterStats::FilterStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Number of prefetch candidates checked against the filter"),
+      ADD_STAT(bloomRejects, statistics::units::Count::get(),
+               "Number of candidates passed by the Bloom filter alone"),
+      ADD_STAT(redundant, statistics::units::Count::get(),
+               "Number of candidates dropped as recently prefetched")
+{
+}
+
+} // namespace prefetch
+} // namespace gem5
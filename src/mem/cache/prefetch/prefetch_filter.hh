@@ -0,0 +1,82 @@
+/**
+ * @file
+ * Recently-issued prefetch filter shared by the prefetchers of a cache.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_PREFETCH_FILTER_HH__
+#define __MEM_CACHE_PREFETCH_PREFETCH_FILTER_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Prefetcher, prefetch);
+namespace prefetch
+{
+
+/**
+ * Filter of recently issued prefetch addresses. One instance is owned by
+ * the top-level prefetcher of a cache and handed to every sub-prefetcher,
+ * so they all drop the same redundant requests and account them in one
+ * place.
+ *
+ * The exact part is a small FIFO CAM with the replacement behaviour of the
+ * boost lru_cache it replaces (contains() does not touch recency and
+ * inserting a present address is a no-op). It is fronted by a counting
+ * Bloom filter kept in sync with the CAM, which answers most misses
+ * without scanning it. Since the Bloom filter never gives false negatives
+ * the filtering decisions are the same as with the CAM alone.
+ */
+class PrefetchFilter : public statistics::Group
+{
+  public:
+    PrefetchFilter(statistics::Group *parent, const std::string &name,
+                   unsigned capacity);
+
+    /** @return True if addr was inserted and not evicted yet. */
+    bool contains(Addr addr);
+
+    /** Record addr as issued, evicting the oldest address when full. */
+    void insert(Addr addr);
+
+    void clear();
+
+    unsigned size() const { return count; }
+
+  private:
+    static constexpr unsigned NumHashes = 2;
+
+    void bloomIndices(Addr addr, unsigned (&idx)[NumHashes]) const;
+    bool camContains(Addr addr) const;
+
+    const unsigned capacity;
+
+    /** FIFO CAM storage, oldest entry at head. */
+    std::vector<Addr> entries;
+    unsigned head = 0;
+    unsigned count = 0;
+
+    /** Counting Bloom filter over the CAM contents. */
+    const unsigned bloomBits;
+    std::vector<uint16_t> bloom;
+
+    struct FilterStats : public statistics::Group
+    {
+        FilterStats(statistics::Group *parent);
+
+        statistics::Scalar lookups;
+        statistics::Scalar bloomRejects;
+        statistics::Scalar redundant;
+    } stats;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_PREFETCH_FILTER_HH__
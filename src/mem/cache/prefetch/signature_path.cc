@@ -99,7 +99,7 @@ SignaturePath::PatternEntry::getStrideEntry(stride_t stride)
 void
 SignaturePath::addPrefetch(Addr ppn, stride_t last_block, stride_t delta, double path_confidence,
                            signature_t signature, bool is_secure, std::vector<AddrPriority> &addresses,
-                           boost::compute::detail::lru_cache<Addr, Addr> &filter)
+                           PrefetchFilter &filter)
 {
     stride_t block = last_block + delta;
 
@@ -233,7 +233,7 @@ SignaturePath::calculateLookaheadConfidence(PatternEntry const &sig,
 
 bool
 SignaturePath::calculatePrefetch(const PrefetchInfo &pfi, std::vector<AddrPriority> &addresses,
-                                 boost::compute::detail::lru_cache<Addr, Addr> &filter, int32_t &best_block_offset)
+                                 PrefetchFilter &filter, int32_t &best_block_offset)
 {
     Addr request_addr = pfi.getAddr();
     Addr ppn = request_addr / sPageBytes;
@@ -359,7 +359,7 @@ SignaturePath::calculatePrefetch(const PrefetchInfo &pfi, std::vector<AddrPriori
 void
 SignaturePath::auxiliaryPrefetcher(Addr ppn, stride_t current_block, bool is_secure,
                                    std::vector<AddrPriority> &addresses,
-                                   boost::compute::detail::lru_cache<Addr, Addr> &filter)
+                                   PrefetchFilter &filter)
 {
     if (addresses.empty()) {
         // Enable the next line prefetcher if no prefetch candidates are found
@@ -370,14 +370,14 @@ SignaturePath::auxiliaryPrefetcher(Addr ppn, stride_t current_block, bool is_sec
 
 bool
 SignaturePath::sendPFWithFilter(Addr addr, std::vector<AddrPriority> &addresses, int prio,
-                                boost::compute::detail::lru_cache<Addr, Addr> &filter)
+                                PrefetchFilter &filter)
 {
     if (filter.contains(addr)) {
         DPRINTF(SPP, "Skip recently prefetched: %lx\n", addr);
         return false;
     } else {
         DPRINTF(SPP, "Send pf: %lx\n", addr);
-        filter.insert(addr, 0);
+        filter.insert(addr);
         addresses.push_back(AddrPriority(addr, prio, PrefetchSourceType::SPP));
         return true;
     }
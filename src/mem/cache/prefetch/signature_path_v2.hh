@@ -87,7 +87,7 @@ class SignaturePathV2 : public SignaturePath
      * prefetcher, so this function does not perform any actions.
      */
     void auxiliaryPrefetcher(Addr ppn, stride_t current_block, bool is_secure, std::vector<AddrPriority> &addresses,
-                             boost::compute::detail::lru_cache<Addr, Addr> &filter) override
+                             PrefetchFilter &filter) override
     {}
 
     virtual void handlePageCrossingLookahead(signature_t signature,
@@ -25,7 +25,7 @@ XSCompositePrefetcher::XSCompositePrefetcher(const XSCompositePrefetcherParams &
       phtPFAhead(p.pht_pf_ahead),
       phtPFLevel(std::min(p.pht_pf_level, (int) 3)),
       stats(this),
-      pfBlockLRUFilter(pfFilterSize),
+      pfBlockLRUFilter(this, "pfBlockFilter", pfFilterSize),
       pfPageLRUFilter(pfPageFilterSize),
       pfPageLRUFilterL2(pfPageFilterSize),
       pfPageLRUFilterL3(pfPageFilterSize),
@@ -559,7 +559,7 @@ XSCompositePrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std:
 
     } else {
         if (!(src == PrefetchSourceType::SStream || src == PrefetchSourceType::StoreStream)) {
-            pfBlockLRUFilter.insert(addr, 0);
+            pfBlockLRUFilter.insert(addr);
         }
         if (archDBer) {
             archDBer->l1PFTraceWrite(curTick(), pfi.getPC(), pfi.getAddr(), addr, src);
@@ -625,7 +625,7 @@ XSCompositePrefetcher::notifyFill(const PacketPtr &pkt)
     if (pkt->req->hasVaddr()) {
         stats.refillNotifyCount++;
         berti->notifyFill(pkt);
-        pfBlockLRUFilter.insert(pkt->req->getVaddr(), 0);
+        pfBlockLRUFilter.insert(pkt->req->getVaddr());
     }
 }
 
@@ -638,6 +638,49 @@ XSCompositePrefetcher::XSCompositeStats::XSCompositeStats(statistics::Group *par
 {
 }
 
+void
+XSCompositePrefetcher::setComponentEnabled(const std::string &component,
+                                           bool enable)
+{
+    bool *flag = nullptr;
+    bool configured = true;
+    if (component == "activepage") {
+        flag = &enableActivepage;
+    } else if (component == "cplx") {
+        flag = &enableCPLX;
+        configured = ipcp;
+    } else if (component == "spp") {
+        flag = &enableSPP;
+        configured = spp;
+    } else if (component == "temporal") {
+        flag = &enableTemporal;
+        configured = cmc;
+    } else if (component == "sstride") {
+        flag = &enableSstride;
+        configured = Sstride;
+    } else if (component == "berti") {
+        flag = &enableBerti;
+        configured = berti;
+    } else if (component == "opt") {
+        flag = &enableOpt;
+        configured = Opt;
+    } else if (component == "xsstream") {
+        flag = &enableXsstream;
+        configured = Xsstream;
+    } else {
+        fatal("%s: unknown prefetcher component '%s'.\n", name(), component);
+    }
+
+    fatal_if(enable && !configured, "%s: component %s is not configured.\n",
+             name(), component);
+    *flag = enable;
+
+    fatal_if(enableActivepage && enableXsstream,
+             "%s: activepage and xsstream cannot both be enabled.\n", name());
+    fatal_if(enableBerti && enableSstride,
+             "%s: berti and sstride cannot both be enabled.\n", name());
+}
+
 void
 XSCompositePrefetcher::setParentInfo(System *sys, ProbeManager *pm, CacheAccessor* _cache, unsigned blk_size)
 {
@@ -656,5 +699,65 @@ XSCompositePrefetcher::setParentInfo(System *sys, ProbeManager *pm, CacheAccesso
         ipcp->setParentInfo(sys, pm, _cache, blk_size);
 }
 
+std::string
+XSCompositePrefetcher::warmStateGeometry() const
+{
+    return csprintf("%s region=%d act=%s re_act=%s pht=%s",
+                    Queued::warmStateGeometry(), regionSize,
+                    act.warmStateGeometry(), re_act.warmStateGeometry(),
+                    pht.warmStateGeometry());
+}
+
+void
+XSCompositePrefetcher::saveWarmState(WarmStateOut &out) const
+{
+    act.saveWarmState(out, [](const ACTEntry &entry, WarmStateOut &out) {
+        out.put(entry.pc);
+        out.put(entry.regionAddr);
+        out.put(entry.regionBits);
+        out.put(entry.inBackwardMode);
+        out.put(entry.accessCount);
+        out.put(entry.regionOffset);
+        out.put(entry.depth);
+        saveCounter(out, entry.lateConf);
+        out.put(entry.hasIncreasedPht);
+    });
+    re_act.saveWarmState(out,
+        [](const ReACTEntry &entry, WarmStateOut &out) {
+            out.put(entry.pc);
+            out.put(entry.regionAddr);
+        });
+    pht.saveWarmState(out, [](const PhtEntry &entry, WarmStateOut &out) {
+        for (const auto &ctr : entry.hist)
+            saveCounter(out, ctr);
+        out.put(entry.pc);
+    });
+}
+
+void
+XSCompositePrefetcher::loadWarmState(WarmStateIn &in)
+{
+    act.loadWarmState(in, [](ACTEntry &entry, WarmStateIn &in) {
+        in.get(entry.pc);
+        in.get(entry.regionAddr);
+        in.get(entry.regionBits);
+        in.get(entry.inBackwardMode);
+        in.get(entry.accessCount);
+        in.get(entry.regionOffset);
+        in.get(entry.depth);
+        loadCounter(in, entry.lateConf);
+        in.get(entry.hasIncreasedPht);
+    });
+    re_act.loadWarmState(in, [](ReACTEntry &entry, WarmStateIn &in) {
+        in.get(entry.pc);
+        in.get(entry.regionAddr);
+    });
+    pht.loadWarmState(in, [](PhtEntry &entry, WarmStateIn &in) {
+        for (auto &ctr : entry.hist)
+            loadCounter(in, ctr);
+        in.get(entry.pc);
+    });
+}
+
 }  // prefetch
 }  // gem5
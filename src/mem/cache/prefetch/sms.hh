@@ -18,6 +18,7 @@
 #include "mem/cache/prefetch/cmc.hh"
 #include "mem/cache/prefetch/ipcp.hh"
 #include "mem/cache/prefetch/opt.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/cache/prefetch/signature_path.hh"
 #include "mem/cache/prefetch/stride.hh"
@@ -155,7 +156,7 @@ class XSCompositePrefetcher : public Queued
   private:
     const unsigned pfFilterSize{256};
     const unsigned pfPageFilterSize{16};
-    boost::compute::detail::lru_cache<Addr, Addr> pfBlockLRUFilter;
+    PrefetchFilter pfBlockLRUFilter;
 
     boost::compute::detail::lru_cache<Addr, Addr> pfPageLRUFilter;
     boost::compute::detail::lru_cache<Addr, Addr> pfPageLRUFilterL2;
@@ -185,14 +186,15 @@ class XSCompositePrefetcher : public Queued
     XsStreamPrefetcher *Xsstream;
 
 
-    const bool enableActivepage;
-    const bool enableCPLX;
-    const bool enableSPP;
-    const bool enableTemporal;
-    const bool enableSstride;
-    const bool enableBerti;
-    const bool enableOpt;
-    const bool enableXsstream;
+    // can be changed at runtime, see setComponentEnabled
+    bool enableActivepage;
+    bool enableCPLX;
+    bool enableSPP;
+    bool enableTemporal;
+    bool enableSstride;
+    bool enableBerti;
+    bool enableOpt;
+    bool enableXsstream;
     const bool phtEarlyUpdate;
     const bool neighborPhtUpdate;
 
@@ -204,6 +206,22 @@ class XSCompositePrefetcher : public Queued
         }
     }
     void setParentInfo(System *sys, ProbeManager *pm, CacheAccessor* _cache, unsigned blk_size) override;
+
+    /**
+     * Turn a component on or off at runtime, named after its enable_*
+     * parameter (e.g. "berti" for enable_berti). Exclusive components
+     * must be switched off before the other one is switched on.
+     */
+    void setComponentEnabled(const std::string &component, bool enable);
+
+    std::string warmStateGeometry() const override;
+
+    /**
+     * Saves the active, re-active and pattern history tables. The
+     * components save their own tables.
+     */
+    void saveWarmState(WarmStateOut &out) const override;
+    void loadWarmState(WarmStateIn &in) override;
 };
 
 }
@@ -10,7 +10,7 @@ GEM5_DEPRECATED_NAMESPACE(Prefetcher, prefetch);
 namespace prefetch
 {
 
-WorkerPrefetcher::WorkerPrefetcher(const WorkerPrefetcherParams &p) : Queued(p), workerStats(this), pfLRUFilter(128)
+WorkerPrefetcher::WorkerPrefetcher(const WorkerPrefetcherParams &p) : Queued(p), workerStats(this), pfLRUFilter(this, "pfFilter", 128)
 {
     //Event *event = new EventFunctionWrapper([this]{ enableFunctionTrace(); }, name(), true);
     transferEvent = new EventFunctionWrapper([this](){
@@ -39,7 +39,7 @@ WorkerPrefetcher::rxHint(BaseMMU::Translation *dpp)
             DPRINTF(WorkerPref, "Worker: offload: [%lx, %d] skip recently in localBuffer\n", ptr->pfInfo.getAddr(), ptr->pfahead_host);
             return;
         }
-        pfLRUFilter.insert(ptr->pfInfo.getAddr(),0);
+        pfLRUFilter.insert(ptr->pfInfo.getAddr());
     }
 
     workerStats.hintsReceived++;
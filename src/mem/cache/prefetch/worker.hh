@@ -9,11 +9,10 @@
 #include <list>
 #include <string>
 
-#include <boost/compute/detail/lru_cache.hpp>
-
 #include "base/sat_counter.hh"
 #include "base/types.hh"
 #include "mem/cache/base.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/WorkerPrefetcher.hh"
@@ -80,7 +79,7 @@ class WorkerPrefetcher : public Queued
     } workerStats;
 
   protected:
-    boost::compute::detail::lru_cache<Addr, Addr> pfLRUFilter;
+    PrefetchFilter pfLRUFilter;
 
     std::list<DeferredPacket> localBuffer;
 
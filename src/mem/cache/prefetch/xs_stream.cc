@@ -110,7 +110,7 @@ XsStreamPrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::ve
         return false;
     } else {
         DPRINTF(XsStreamPrefetcher, "Send pf: %lx\n", addr);
-        filter->insert(addr, 0);
+        filter->insert(addr);
         addresses.push_back(AddrPriority(addr, prio, src));
         streamBlkFilter.insert(addr, 0);
         if (ahead_level > 1) {
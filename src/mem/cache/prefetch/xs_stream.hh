@@ -10,6 +10,7 @@
 #include "base/types.hh"
 #include "debug/XsStreamPrefetcher.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/XsStreamPrefetcher.hh"
@@ -80,7 +81,7 @@ class XsStreamPrefetcher : public Queued
                           PrefetchSourceType src, int ahead_level = -1);
 
   public:
-    boost::compute::detail::lru_cache<Addr, Addr> *filter;
+    PrefetchFilter *filter;
     const unsigned pfFilterSize{256};
     boost::compute::detail::lru_cache<Addr, Addr> streamBlkFilter;
     XsStreamPrefetcher(const XsStreamPrefetcherParams &p);
@@ -244,7 +244,7 @@ XSStridePrefetcher::sendPFWithFilter(const PrefetchInfo &pfi, Addr addr, std::ve
         return false;
     } else {
         DPRINTF(XSStridePrefetcher, "Send pf: %lx\n", addr);
-        filter->insert(addr, 0);
+        filter->insert(addr);
         addresses.push_back(AddrPriority(addr, prio, src));
         return true;
     }
@@ -260,6 +260,72 @@ XSStridePrefetcher::strideHashPc(Addr pc)
     return (pc_high << 10) | pc_low;
 }
 
+std::string
+XSStridePrefetcher::warmStateGeometry() const
+{
+    return csprintf("%s unique=%s redundant=%s non_stride=%s",
+                    Queued::warmStateGeometry(),
+                    strideUnique.warmStateGeometry(),
+                    strideRedundant.warmStateGeometry(),
+                    nonStridePCs.warmStateGeometry());
+}
+
+void
+XSStridePrefetcher::saveStrideEntry(const StrideEntry &entry,
+                                    WarmStateOut &out)
+{
+    out.put(entry.stride);
+    out.put(entry.lastAddr);
+    saveCounter(out, entry.conf);
+    out.put(entry.depth);
+    saveCounter(out, entry.lateConf);
+    saveCounter(out, entry.longStride);
+    out.put(entry.pc);
+    out.put<uint64_t>(entry.histStrides.size());
+    for (Addr stride : entry.histStrides)
+        out.put(stride);
+    out.put(entry.matchedSinceAlloc);
+}
+
+void
+XSStridePrefetcher::loadStrideEntry(StrideEntry &entry, WarmStateIn &in)
+{
+    in.get(entry.stride);
+    in.get(entry.lastAddr);
+    loadCounter(in, entry.conf);
+    in.get(entry.depth);
+    loadCounter(in, entry.lateConf);
+    loadCounter(in, entry.longStride);
+    in.get(entry.pc);
+    entry.histStrides.clear();
+    for (uint64_t n = in.get<uint64_t>(); n > 0; n--)
+        entry.histStrides.push_back(in.get<Addr>());
+    in.get(entry.matchedSinceAlloc);
+}
+
+void
+XSStridePrefetcher::saveWarmState(WarmStateOut &out) const
+{
+    out.put(depthDownCounter);
+    strideUnique.saveWarmState(out, saveStrideEntry);
+    strideRedundant.saveWarmState(out, saveStrideEntry);
+    nonStridePCs.saveWarmState(out,
+        [](const NonStrideEntry &entry, WarmStateOut &out) {
+            out.put(entry.pc);
+        });
+}
+
+void
+XSStridePrefetcher::loadWarmState(WarmStateIn &in)
+{
+    in.get(depthDownCounter);
+    strideUnique.loadWarmState(in, loadStrideEntry);
+    strideRedundant.loadWarmState(in, loadStrideEntry);
+    nonStridePCs.loadWarmState(in, [](NonStrideEntry &entry, WarmStateIn &in) {
+        in.get(entry.pc);
+    });
+}
+
 }
 
 }
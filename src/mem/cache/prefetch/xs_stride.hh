@@ -7,13 +7,12 @@
 #include <unordered_map>
 #include <vector>
 
-#include <boost/compute/detail/lru_cache.hpp>
-
 #include "base/sat_counter.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "debug/XSStridePrefetcher.hh"
 #include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/prefetch_filter.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "mem/packet.hh"
 #include "params/XSStridePrefetcher.hh"
@@ -64,6 +63,9 @@ class XSStridePrefetcher : public Queued
 
     const unsigned maxHistStrides{12};
 
+    static void saveStrideEntry(const StrideEntry &entry, WarmStateOut &out);
+    static void loadStrideEntry(StrideEntry &entry, WarmStateIn &in);
+
     //const bool strideDynDepth{false};
 
     int depthDownCounter{0};
@@ -102,7 +104,7 @@ class XSStridePrefetcher : public Queued
     Addr strideHashPc(Addr pc);
 
   public:
-    boost::compute::detail::lru_cache<Addr, Addr> *filter;
+    PrefetchFilter *filter;
     XSStridePrefetcher(const XSStridePrefetcherParams &p);
 
     void calculatePrefetch(const PrefetchInfo &pfi, std::vector<AddrPriority> &addressed) override
@@ -114,6 +116,12 @@ class XSStridePrefetcher : public Queued
     void calculatePrefetch(const PrefetchInfo &pfi, std::vector<AddrPriority> &addresses, bool late,
                            PrefetchSourceType pf_source, bool miss_repeat, bool enter_new_region, bool is_first_shot,
                            Addr &pf_addr, int64_t &learned_bop_offset);
+
+    std::string warmStateGeometry() const override;
+
+    /** Saves the stride tables and the non-stride PC filter. */
+    void saveWarmState(WarmStateOut &out) const override;
+    void loadWarmState(WarmStateIn &in) override;
 };
 }
 
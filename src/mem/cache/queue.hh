@@ -49,6 +49,7 @@
 #include <string>
 #include <type_traits>
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
 #include "base/trace.hh"
@@ -101,6 +102,46 @@ class Queue : public Drainable, public Named
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /**
+     * Number of bits used to select a bucket of the address index. The
+     * index has at least twice as many buckets as entries.
+     */
+    const unsigned addrIndexBits;
+
+    /**
+     * Block address index over the allocated entries. Each bucket is a
+     * chain through QueueEntry::indexNext kept in allocation order, so a
+     * lookup returns the same entry as a scan of the allocatedList.
+     */
+    std::vector<QueueEntry*> addrIndex;
+
+    size_t indexBucket(Addr addr) const
+    {
+        return (addr * 0x9e3779b97f4a7c15ULL) >> (64 - addrIndexBits);
+    }
+
+    /** Add a freshly allocated entry to the address index. */
+    void addToIndex(Entry* entry)
+    {
+        assert(!entry->indexNext);
+        QueueEntry **link = &addrIndex[indexBucket(entry->blkAddr)];
+        while (*link) {
+            link = &(*link)->indexNext;
+        }
+        *link = entry;
+    }
+
+    void removeFromIndex(Entry* entry)
+    {
+        QueueEntry **link = &addrIndex[indexBucket(entry->blkAddr)];
+        while (*link != entry) {
+            assert(*link);
+            link = &(*link)->indexNext;
+        }
+        *link = entry->indexNext;
+        entry->indexNext = nullptr;
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -135,6 +176,8 @@ class Queue : public Drainable, public Named
         Named(name),
         label(_label), numEntries(num_entries + reserve),
         numReserve(reserve), entries(numEntries, name + ".entry"),
+        addrIndexBits(ceilLog2(numEntries) + 1),
+        addrIndex(1ULL << addrIndexBits, nullptr),
         _numInService(0), allocated(0)
     {
         for (int i = 0; i < numEntries; ++i) {
@@ -168,7 +211,9 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        for (QueueEntry *qe = addrIndex[indexBucket(blk_addr)]; qe;
+             qe = qe->indexNext) {
+            Entry *entry = static_cast<Entry*>(qe);
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -206,6 +251,21 @@ class Queue : public Drainable, public Named
      */
     Entry* findPending(const QueueEntry* entry) const
     {
+        // Use the address index to find the candidates, only fall back
+        // to the readyList order when more than one of them is pending
+        Entry *candidate = nullptr;
+        int num_candidates = 0;
+        for (QueueEntry *qe = addrIndex[indexBucket(entry->blkAddr)]; qe;
+             qe = qe->indexNext) {
+            if (!qe->inService && qe->conflictAddr(entry)) {
+                candidate = static_cast<Entry*>(qe);
+                num_candidates++;
+            }
+        }
+        if (num_candidates <= 1) {
+            return candidate;
+        }
+
         for (const auto& ready_entry : readyList) {
             if (ready_entry->conflictAddr(entry)) {
                 return ready_entry;
@@ -241,6 +301,7 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        removeFromIndex(entry);
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
@@ -68,6 +68,11 @@ class QueueEntry : public Packet::SenderState, public Named
     template <class Entry>
     friend class Queue;
 
+  private:
+
+    /** Next entry in the same bucket of the owning queue's address index */
+    QueueEntry *indexNext;
+
   protected:
 
     /** Tick when ready to issue */
@@ -122,7 +127,7 @@ class QueueEntry : public Packet::SenderState, public Named
     bool isSecure;
 
     QueueEntry(const std::string &name)
-        : Named(name),
+        : Named(name), indexNext(nullptr),
           readyTime(0), _isUncacheable(false),
           inService(false), order(0), blkAddr(0), blkSize(0), isSecure(false)
     {}
@@ -36,6 +36,7 @@
 #include "mem/packet.hh"
 #include "params/BaseReplacementPolicy.hh"
 #include "sim/sim_object.hh"
+#include "sim/warm_state.hh"
 
 namespace gem5
 {
@@ -110,6 +111,51 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Recency of an entry in a warm state snapshot. Entries are restored
+     * in increasing order of it, and the policies with no notion of time
+     * leave it at 0.
+     *
+     * @param replacement_data Replacement data of a valid entry.
+     * @return The tick of the entry, larger being more recent.
+     */
+    virtual Tick
+    warmStateTick(const std::shared_ptr<ReplacementData>&
+        replacement_data) const
+    {
+        return 0;
+    }
+
+    /**
+     * Save the replacement data of an entry to a warm state snapshot.
+     *
+     * @param replacement_data Replacement data of a valid entry.
+     * @param out Section of the owner of the entry.
+     */
+    virtual void
+    saveWarmState(const std::shared_ptr<ReplacementData>& replacement_data,
+                  WarmStateOut &out) const
+    {
+    }
+
+    /**
+     * Restore the replacement data saved by saveWarmState. The snapshot
+     * comes from another run, so its ticks are not reused: the entry
+     * gets the rank of its tick among the restored entries of its set
+     * instead, starting at 1. Restored entries thus keep their order,
+     * stay ahead of the invalidated ones and behind anything touched
+     * once the simulation starts.
+     *
+     * @param replacement_data Replacement data of the restored entry.
+     * @param in Section of the owner of the entry.
+     * @param rank Rank of the saved tick of the entry in its set.
+     */
+    virtual void
+    loadWarmState(const std::shared_ptr<ReplacementData>& replacement_data,
+                  WarmStateIn &in, Tick rank) const
+    {
+    }
 };
 
 } // namespace replacement_policy
@@ -28,6 +28,7 @@
 
 #include "mem/cache/replacement_policies/brrip_rp.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -148,5 +149,29 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+void
+BRRIP::saveWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateOut &out) const
+{
+    std::shared_ptr<BRRIPReplData> casted_replacement_data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    out.put<uint8_t>(casted_replacement_data->rrpv);
+    out.put<bool>(casted_replacement_data->valid);
+}
+
+void
+BRRIP::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    std::shared_ptr<BRRIPReplData> casted_replacement_data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    // the snapshot may come from a policy with fewer bits
+    casted_replacement_data->rrpv = SatCounter8(numRRPVBits,
+        std::min<unsigned>(in.get<uint8_t>(), (1 << numRRPVBits) - 1));
+    casted_replacement_data->valid = in.get<bool>();
+}
+
 } // namespace replacement_policy
 } // namespace gem5
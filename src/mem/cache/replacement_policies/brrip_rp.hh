@@ -158,6 +158,25 @@ class BRRIP : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Saves the RRPV and validity of the entry.
+     *
+     * @param replacement_data Replacement data of a valid entry.
+     * @param out Section of the owner of the entry.
+     */
+    void saveWarmState(const std::shared_ptr<ReplacementData>&
+        replacement_data, WarmStateOut &out) const override;
+
+    /**
+     * Restores the RRPV and validity of the entry.
+     *
+     * @param replacement_data Replacement data of the restored entry.
+     * @param in Section of the owner of the entry.
+     * @param rank Unused, the RRPVs order the entries.
+     */
+    void loadWarmState(const std::shared_ptr<ReplacementData>&
+        replacement_data, WarmStateIn &in, Tick rank) const override;
 };
 
 } // namespace replacement_policy
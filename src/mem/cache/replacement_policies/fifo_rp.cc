@@ -95,5 +95,20 @@ FIFO::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new FIFOReplData());
 }
 
+Tick
+FIFO::warmStateTick(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<FIFOReplData>(replacement_data)->tickInserted;
+}
+
+void
+FIFO::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    std::static_pointer_cast<FIFOReplData>(replacement_data)->tickInserted = rank;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -110,6 +110,25 @@ class FIFO : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Insertion tick of the entry, to restore the entries in order.
+     *
+     * @param replacement_data Replacement data of a valid entry.
+     * @return The insertion tick.
+     */
+    Tick warmStateTick(const std::shared_ptr<ReplacementData>&
+        replacement_data) const override;
+
+    /**
+     * Sets the insertion tick of a restored entry to its rank.
+     *
+     * @param replacement_data Replacement data of the restored entry.
+     * @param in Section of the owner of the entry.
+     * @param rank Rank of the saved tick of the entry in its set.
+     */
+    void loadWarmState(const std::shared_ptr<ReplacementData>&
+        replacement_data, WarmStateIn &in, Tick rank) const override;
 };
 
 } // namespace replacement_policy
@@ -93,5 +93,23 @@ LFU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LFUReplData());
 }
 
+void
+LFU::saveWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateOut &out) const
+{
+    out.put<unsigned>(
+        std::static_pointer_cast<LFUReplData>(replacement_data)->refCount);
+}
+
+void
+LFU::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    std::static_pointer_cast<LFUReplData>(replacement_data)->refCount =
+        in.get<unsigned>();
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -97,5 +97,20 @@ LRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LRUReplData());
 }
 
+Tick
+LRU::warmStateTick(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<LRUReplData>(replacement_data)->lastTouchTick;
+}
+
+void
+LRU::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    std::static_pointer_cast<LRUReplData>(replacement_data)->lastTouchTick = rank;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
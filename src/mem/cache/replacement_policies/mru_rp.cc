@@ -102,5 +102,20 @@ MRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new MRUReplData());
 }
 
+Tick
+MRU::warmStateTick(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    return std::static_pointer_cast<MRUReplData>(replacement_data)->lastTouchTick;
+}
+
+void
+MRU::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    std::static_pointer_cast<MRUReplData>(replacement_data)->lastTouchTick = rank;
+}
+
 } // namespace replacement_policy
 } // namespace gem5
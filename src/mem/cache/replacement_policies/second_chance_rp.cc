@@ -138,5 +138,24 @@ SecondChance::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SecondChanceReplData());
 }
 
+void
+SecondChance::saveWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateOut &out) const
+{
+    out.put<bool>(std::static_pointer_cast<SecondChanceReplData>(
+        replacement_data)->hasSecondChance);
+}
+
+void
+SecondChance::loadWarmState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    WarmStateIn &in, Tick rank) const
+{
+    FIFO::loadWarmState(replacement_data, in, rank);
+    std::static_pointer_cast<SecondChanceReplData>(
+        replacement_data)->hasSecondChance = in.get<bool>();
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -126,6 +126,26 @@ class SecondChance : public FIFO
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Saves whether the entry has a second chance of the entry.
+     *
+     * @param replacement_data Replacement data of a valid entry.
+     * @param out Section of the owner of the entry.
+     */
+    void saveWarmState(const std::shared_ptr<ReplacementData>&
+        replacement_data, WarmStateOut &out) const override;
+
+    /**
+     * Restores the insertion tick of the entry as its rank, and whether
+     * it has a second chance.
+     *
+     * @param replacement_data Replacement data of the restored entry.
+     * @param in Section of the owner of the entry.
+     * @param rank Rank of the saved tick of the entry in its set.
+     */
+    void loadWarmState(const std::shared_ptr<ReplacementData>&
+        replacement_data, WarmStateIn &in, Tick rank) const override;
 };
 
 } // namespace replacement_policy
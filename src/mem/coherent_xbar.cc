@@ -289,10 +289,18 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                 pkt->clearWriteThrough();
             }
 
+            // the response comes back through a memory-side port, so
+            // let it carry its route
+            if (expect_response)
+                pushRoute(pkt, cpu_side_port_id);
+
             // since it is a normal request, attempt to send the packet
             DPRINTF(CoherentXBar, "%s: Forwarding %s to port %s\n", __func__,
                     pkt->print(), memSidePorts[mem_side_port_id]->name());
             success = memSidePorts[mem_side_port_id]->sendTimingReq(pkt);
+
+            if (!success && expect_response)
+                popRoute(pkt);
         } else {
             // no need to forward, turn this packet around and respond
             // directly
@@ -340,8 +348,9 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                          name(), maxOutstandingSnoopCheck);
             }
 
-            // remember where to route the normal response to
-            if (expect_response || expect_snoop_resp) {
+            // remember where to route the normal response to, unless
+            // the forwarded packet carries it
+            if (expect_snoop_resp || (expect_response && sink_packet)) {
                 assert(routeTo.find(pkt->req) == routeTo.end());
                 routeTo[pkt->req] = cpu_side_port_id;
 
@@ -452,9 +461,7 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     RequestPort *src_port = memSidePorts[mem_side_port_id];
 
     // determine the destination
-    const auto route_lookup = routeTo.find(pkt->req);
-    assert(route_lookup != routeTo.end());
-    const PortID cpu_side_port_id = route_lookup->second;
+    const PortID cpu_side_port_id = peekRoute(pkt);
     assert(cpu_side_port_id != InvalidPortID);
     assert(cpu_side_port_id < respLayers.size());
 
@@ -489,6 +496,9 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
         snoopFilter->updateResponse(pkt, *cpuSidePorts[cpu_side_port_id]);
     }
 
+    // the route is no longer needed
+    popRoute(pkt);
+
     // send the packet through the destination CPU-side port and pay for
     // any outstanding header delay
     Tick latency = pkt->headerDelay;
@@ -496,9 +506,6 @@ CoherentXBar::recvTimingResp(PacketPtr pkt, PortID mem_side_port_id)
     cpuSidePorts[cpu_side_port_id]->schedTimingResp(pkt, curTick()
                                         + latency);
 
-    // remove the request from the routing table
-    routeTo.erase(route_lookup);
-
     DPRINTF(CoherentXBar, "%s: will holdin the resp layer until %d\n", __func__, packetFinishTime);
     respLayers[cpu_side_port_id]->succeededTiming(packetFinishTime);
 
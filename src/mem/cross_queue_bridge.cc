@@ -0,0 +1,297 @@
+#include "mem/cross_queue_bridge.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+CrossQueueBridge::Ring::Ring(size_t capacity)
+    : slots(size_t(1) << ceilLog2(capacity)), mask(slots.size() - 1)
+{
+}
+
+bool
+CrossQueueBridge::Ring::push(const Transfer &transfer)
+{
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) == slots.size())
+        return false;
+    slots[t & mask] = transfer;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+const CrossQueueBridge::Transfer *
+CrossQueueBridge::Ring::front() const
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+        return nullptr;
+    return &slots[h & mask];
+}
+
+void
+CrossQueueBridge::Ring::pop()
+{
+    head.store(head.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+}
+
+CrossQueueBridge::CrossQueueBridge(const CrossQueueBridgeParams &p)
+    : SimObject(p),
+      cpuSidePort(p.name + ".cpu_side_port", *this),
+      memSidePort(p.name + ".mem_side_port", *this),
+      cpuSideQueue(getEventQueue(p.cpu_side_eventq_index)),
+      delay(p.delay),
+      reqRing(p.req_size),
+      respRing(p.resp_size),
+      respQueueLimit(p.resp_size),
+      cpuSidePollEvent([this]{ cpuSidePoll(); }, name() + ".cpuSidePoll"),
+      memSidePollEvent([this]{ memSidePoll(); }, name() + ".memSidePoll"),
+      sendRespEvent([this]{ sendResps(); }, name() + ".sendResp"),
+      sendReqEvent([this]{ sendReqs(); }, name() + ".sendReq")
+{
+    fatal_if(p.req_size == 0 || p.resp_size == 0,
+             "%s needs room for at least one request and response.\n",
+             name());
+}
+
+void
+CrossQueueBridge::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Both ports of %s must be connected.\n", name());
+
+    fatal_if(cpuSideQueue != memSideQueue() && delay < simQuantum,
+             "%s: delay %d is shorter than the simulation quantum %d.\n",
+             name(), delay, simQuantum);
+
+    cpuSidePort.sendRangeChange();
+}
+
+void
+CrossQueueBridge::startup()
+{
+    cpuSideQueue->schedule(&cpuSidePollEvent,
+                           cpuSideQueue->getCurTick() + pollPeriod());
+    schedule(memSidePollEvent, curTick() + pollPeriod());
+}
+
+Port &
+CrossQueueBridge::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "cpu_side_port") {
+        return cpuSidePort;
+    } else if (if_name == "mem_side_port") {
+        return memSidePort;
+    } else {
+        return SimObject::getPort(if_name, idx);
+    }
+}
+
+Tick
+CrossQueueBridge::pollPeriod() const
+{
+    // a single-queue run has no quantum; any period works there
+    return simQuantum ? simQuantum : std::max<Tick>(delay, 1);
+}
+
+void
+CrossQueueBridge::drainRing(Ring &ring, std::deque<Transfer> &pending,
+                            Tick now)
+{
+    while (const Transfer *transfer = ring.front()) {
+        if (transfer->tick + simQuantum > now)
+            break;
+        PacketPtr pkt = transfer->pkt;
+        // as in Bridge, the packet only arrives after its header delay
+        // and payload
+        Tick due = transfer->tick + delay + pkt->headerDelay +
+            pkt->payloadDelay;
+        pkt->headerDelay = pkt->payloadDelay = 0;
+        pending.push_back({pkt, std::max(due, now)});
+        ring.pop();
+    }
+}
+
+void
+CrossQueueBridge::memSidePoll()
+{
+    drainRing(reqRing, pendingReqs, curTick());
+    if (!pendingReqs.empty() && !waitingReqRetry &&
+        !sendReqEvent.scheduled()) {
+        schedule(sendReqEvent, std::max(pendingReqs.front().tick, curTick()));
+    }
+    schedule(memSidePollEvent, curTick() + pollPeriod());
+}
+
+void
+CrossQueueBridge::cpuSidePoll()
+{
+    Tick now = cpuSideQueue->getCurTick();
+    drainRing(respRing, pendingResps, now);
+    if (!pendingResps.empty() && !waitingRespRetry &&
+        !sendRespEvent.scheduled()) {
+        cpuSideQueue->schedule(&sendRespEvent,
+                               std::max(pendingResps.front().tick, now));
+    }
+
+    if (retryReq && !reqRing.full() &&
+        outstandingResponses < respQueueLimit) {
+        retryReq = false;
+        cpuSidePort.sendRetryReq();
+    }
+
+    if (drainState() == DrainState::Draining && idle())
+        signalDrainDone();
+
+    cpuSideQueue->schedule(&cpuSidePollEvent, now + pollPeriod());
+}
+
+void
+CrossQueueBridge::sendReqs()
+{
+    while (!pendingReqs.empty() && pendingReqs.front().tick <= curTick()) {
+        if (!memSidePort.sendTimingReq(pendingReqs.front().pkt)) {
+            waitingReqRetry = true;
+            return;
+        }
+        pendingReqs.pop_front();
+        --inFlight;
+    }
+    if (!pendingReqs.empty())
+        schedule(sendReqEvent, pendingReqs.front().tick);
+}
+
+void
+CrossQueueBridge::sendResps()
+{
+    Tick now = cpuSideQueue->getCurTick();
+    while (!pendingResps.empty() && pendingResps.front().tick <= now) {
+        if (!cpuSidePort.sendTimingResp(pendingResps.front().pkt)) {
+            waitingRespRetry = true;
+            return;
+        }
+        pendingResps.pop_front();
+        --inFlight;
+        assert(outstandingResponses > 0);
+        --outstandingResponses;
+    }
+    if (!pendingResps.empty())
+        cpuSideQueue->schedule(&sendRespEvent, pendingResps.front().tick);
+}
+
+bool
+CrossQueueBridge::idle() const
+{
+    return inFlight == 0 && outstandingResponses == 0;
+}
+
+DrainState
+CrossQueueBridge::drain()
+{
+    return idle() ? DrainState::Drained : DrainState::Draining;
+}
+
+bool
+CrossQueueBridge::CpuSidePort::recvTimingReq(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    if (bridge.retryReq)
+        return false;
+
+    bool expects_response = pkt->needsResponse();
+    if (bridge.reqRing.full() || (expects_response &&
+            bridge.outstandingResponses == bridge.respQueueLimit)) {
+        bridge.retryReq = true;
+        return false;
+    }
+
+    if (expects_response)
+        ++bridge.outstandingResponses;
+    ++bridge.inFlight;
+    bool pushed = bridge.reqRing.push({pkt, curTick()});
+    assert(pushed);
+    (void)pushed;
+    return true;
+}
+
+void
+CrossQueueBridge::CpuSidePort::recvRespRetry()
+{
+    bridge.waitingRespRetry = false;
+    bridge.sendResps();
+}
+
+Tick
+CrossQueueBridge::CpuSidePort::recvAtomic(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.memSideQueue());
+    return bridge.delay + bridge.memSidePort.sendAtomic(pkt);
+}
+
+void
+CrossQueueBridge::CpuSidePort::recvFunctional(PacketPtr pkt)
+{
+    auto satisfies = [pkt](const Transfer &transfer) {
+        return pkt->trySatisfyFunctional(transfer.pkt);
+    };
+
+    pkt->pushLabel(name());
+
+    if (std::any_of(bridge.pendingResps.begin(), bridge.pendingResps.end(),
+                    satisfies)) {
+        pkt->makeResponse();
+        return;
+    }
+
+    // with the memory side queue locked neither ring can move
+    EventQueue::ScopedMigration migrate(bridge.memSideQueue());
+    if (bridge.respRing.anyOf(satisfies) ||
+        bridge.reqRing.anyOf(satisfies) ||
+        std::any_of(bridge.pendingReqs.begin(), bridge.pendingReqs.end(),
+                    satisfies)) {
+        pkt->makeResponse();
+        return;
+    }
+
+    pkt->popLabel();
+
+    bridge.memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+CrossQueueBridge::CpuSidePort::getAddrRanges() const
+{
+    return bridge.memSidePort.getAddrRanges();
+}
+
+bool
+CrossQueueBridge::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    // space was reserved when the request was accepted
+    ++bridge.inFlight;
+    bool pushed = bridge.respRing.push({pkt, curTick()});
+    panic_if(!pushed, "%s: response ring overflow.\n", name());
+    return true;
+}
+
+void
+CrossQueueBridge::MemSidePort::recvReqRetry()
+{
+    bridge.waitingReqRetry = false;
+    bridge.sendReqs();
+}
+
+void
+CrossQueueBridge::MemSidePort::recvRangeChange()
+{
+    bridge.cpuSidePort.sendRangeChange();
+}
+
+} // namespace gem5
@@ -0,0 +1,220 @@
+/**
+ * @file
+ * Lock-free timing bridge between two event queues in a parallel
+ * (multi-queue) simulation.
+ */
+
+#ifndef __MEM_CROSS_QUEUE_BRIDGE_HH__
+#define __MEM_CROSS_QUEUE_BRIDGE_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "mem/port.hh"
+#include "params/CrossQueueBridge.hh"
+#include "sim/drain.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * EventQueueBoundary hands every crossing over at the quantum barrier,
+ * while all threads wait. This bridge instead hands timing packets over
+ * through one single-producer/single-consumer ring per direction while
+ * both sides run, so the two host threads only share the ring indices.
+ *
+ * The producer stamps each packet with its own current tick. The consumer
+ * polls its ring once per simulation quantum and only takes packets stamped
+ * at least one quantum before its own current tick: the threads are within
+ * a quantum of each other, so those pushes are complete and the set of
+ * packets taken by a poll does not depend on host thread timing. A packet
+ * is delivered at stamp + delay, or at the poll that takes it if that is
+ * later, which is why the delay must not be shorter than the quantum.
+ *
+ * Space for the response of every accepted request is reserved up front,
+ * as in Bridge, so the memory side never blocks on the response ring. When
+ * the request ring is full the sender is told to retry after a later poll
+ * of the CPU side; this back-pressure is the one place where host timing
+ * can leak into the simulation, so the rings should be sized to make it
+ * rare.
+ *
+ * The bridge does not snoop. Coherent crossings need snoop results inside
+ * the forwarding call and keep using EventQueueBoundary. Atomic and
+ * functional accesses still migrate to the memory side queue.
+ */
+class CrossQueueBridge : public SimObject
+{
+  private:
+    /** A packet and the tick it was sent or is due at. */
+    struct Transfer
+    {
+        PacketPtr pkt;
+        Tick tick;
+    };
+
+    /**
+     * Bounded ring written by one thread and read by another. The indices
+     * run freely and are masked on access.
+     */
+    class Ring
+    {
+      private:
+        std::vector<Transfer> slots;
+        const size_t mask;
+
+        alignas(64) std::atomic<size_t> head{0};
+        alignas(64) std::atomic<size_t> tail{0};
+
+      public:
+        Ring(size_t capacity);
+
+        /** Producer side. */
+        bool push(const Transfer &transfer);
+
+        bool
+        full() const
+        {
+            return tail.load(std::memory_order_relaxed) -
+                head.load(std::memory_order_acquire) == slots.size();
+        }
+
+        /** Consumer side: oldest entry, or nullptr if the ring is empty. */
+        const Transfer *front() const;
+        void pop();
+
+        /**
+         * True if f holds for any entry. Only safe while neither side can
+         * run, e.g. with the consumer's queue locked by the producer.
+         */
+        template <typename F>
+        bool
+        anyOf(F f) const
+        {
+            size_t end = tail.load(std::memory_order_acquire);
+            for (size_t i = head.load(std::memory_order_acquire); i != end;
+                 ++i) {
+                if (f(slots[i & mask]))
+                    return true;
+            }
+            return false;
+        }
+
+        bool
+        empty() const
+        {
+            return head.load(std::memory_order_acquire) ==
+                tail.load(std::memory_order_acquire);
+        }
+    };
+
+    class CpuSidePort : public ResponsePort
+    {
+      private:
+        CrossQueueBridge &bridge;
+
+      public:
+        CpuSidePort(const std::string &_name, CrossQueueBridge &_bridge)
+            : ResponsePort(_name, &_bridge), bridge(_bridge)
+        {}
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class MemSidePort : public RequestPort
+    {
+      private:
+        CrossQueueBridge &bridge;
+
+      public:
+        MemSidePort(const std::string &_name, CrossQueueBridge &_bridge)
+            : RequestPort(_name, &_bridge), bridge(_bridge)
+        {}
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRangeChange() override;
+    };
+
+    CpuSidePort cpuSidePort;
+    MemSidePort memSidePort;
+
+    /** Queue owning the objects connected to the CPU side port. */
+    EventQueue *const cpuSideQueue;
+
+    /** Queue owning the objects connected to the memory side port. */
+    EventQueue *memSideQueue() const { return eventQueue(); }
+
+    const Tick delay;
+
+    /** CPU side to memory side. */
+    Ring reqRing;
+    /** Memory side to CPU side. */
+    Ring respRing;
+
+    /** State owned by the CPU side thread. */
+    /** @{ */
+    const unsigned respQueueLimit;
+    unsigned outstandingResponses = 0;
+    bool retryReq = false;
+    bool waitingRespRetry = false;
+    std::deque<Transfer> pendingResps;
+    /** @} */
+
+    /** State owned by the memory side thread. */
+    /** @{ */
+    bool waitingReqRetry = false;
+    std::deque<Transfer> pendingReqs;
+    /** @} */
+
+    /** Tick between polls of each ring. */
+    Tick pollPeriod() const;
+
+    /**
+     * Move packets that are visible to this side out of a ring into its
+     * pending queue.
+     */
+    void drainRing(Ring &ring, std::deque<Transfer> &pending, Tick now);
+
+    void cpuSidePoll();
+    void memSidePoll();
+    void sendResps();
+    void sendReqs();
+
+    EventFunctionWrapper cpuSidePollEvent;
+    EventFunctionWrapper memSidePollEvent;
+    EventFunctionWrapper sendRespEvent;
+    EventFunctionWrapper sendReqEvent;
+
+    /** Packets in a ring or waiting to be sent by the receiving side. */
+    std::atomic<unsigned> inFlight{0};
+
+    /** Called by the CPU side, which owns outstandingResponses. */
+    bool idle() const;
+
+  public:
+    CrossQueueBridge(const CrossQueueBridgeParams &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+    void startup() override;
+
+    DrainState drain() override;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CROSS_QUEUE_BRIDGE_HH__
@@ -59,116 +59,125 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
-
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
+    // Only the oldest packet to the open row and the oldest packet to
+    // another row of each bank can be chosen, so look at those instead of
+    // the whole queue. Queue order is arrival order, see queueSeq.
+    const std::vector<uint64_t> &busy = queue.busyBankMask(pseudoChannel);
+    auto older = [](MemPacketQueue::iterator a, MemPacketQueue::iterator b,
+                    MemPacketQueue::iterator end)
+    {
+        return b == end || (*a)->queueSeq < (*b)->queueSeq;
+    };
 
     // search for seamless row hits first, if no seamless row hit is
     // found then determine if there are other packets that can be issued
     // without incurring additional bus delay due to bank timing
     // Will select closed rows first to enable more open row possibilies
     // in future selections
-    bool found_hidden_bank = false;
+    auto seamless_it = queue.end();
+    Tick seamless_col_at = MaxTick;
 
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
+    // the oldest row hit, not seamless, but bank prepped and ready
+    auto prepped_it = queue.end();
+    Tick prepped_col_at = MaxTick;
 
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
+    // whether any bank has a packet to a closed row
+    bool any_miss = false;
 
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
+    for (unsigned w = 0; w < busy.size(); w++) {
+        for (uint64_t bits = busy[w]; bits; bits &= bits - 1) {
+            const uint16_t bank_id = w * 64 + findLsbSet(bits);
+            const Rank &rank = *ranks[bank_id / banksPerRank];
+            const Bank &bank = rank.banks[bank_id % banksPerRank];
 
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        MemPacket* pkt = *i;
+            // check if rank is not doing a refresh and thus is available,
+            // if not, jump to the next bank
+            if (!rank.inRefIdleState()) {
+                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n",
+                        __func__, bank.bank, rank.rank);
+                continue;
+            }
 
-        // select optimal DRAM packet in Q
-        if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
-            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
+            // check for a row hit
+            auto hit = queue.oldestInRow(pseudoChannel, bank_id,
+                                         bank.openRow);
+            if (hit != queue.end()) {
+                const Tick col_allowed_at = (*hit)->isRead() ?
+                    bank.rdAllowedAt : bank.wrAllowedAt;
+                // no additional rank-to-rank or same bank-group
+                // delays, or we switched read/write and might as well
+                // go for the row hit
+                if (col_allowed_at <= min_col_at) {
+                    // FCFS within the hits, giving priority to
+                    // commands that can issue seamlessly, without
+                    // additional delay, such as same rank accesses
+                    // and/or different bank-group accesses
+                    if (older(hit, seamless_it, queue.end())) {
+                        seamless_it = hit;
+                        seamless_col_at = col_allowed_at;
+                    }
+                } else if (older(hit, prepped_it, queue.end())) {
+                    prepped_it = hit;
+                    prepped_col_at = col_allowed_at;
+                }
+            }
 
-            DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
-                    __func__, pkt->bank, pkt->row);
+            any_miss = any_miss ||
+                queue.oldestNotInRow(pseudoChannel, bank_id,
+                                     bank.openRow) != queue.end();
+        }
+    }
 
-            // check if rank is not doing a refresh and thus is available,
-            // if not, jump to the next packet
-            if (burstReady(pkt)) {
-
-                DPRINTF(DRAM,
-                        "%s bank %d - Rank %d available\n", __func__,
-                        pkt->bank, pkt->rank);
-
-                // check if it is a row hit
-                if (bank.openRow == pkt->row) {
-                    // no additional rank-to-rank or same bank-group
-                    // delays, or we switched read/write and might as well
-                    // go for the row hit
-                    if (col_allowed_at <= min_col_at) {
-                        // FCFS within the hits, giving priority to
-                        // commands that can issue seamlessly, without
-                        // additional delay, such as same rank accesses
-                        // and/or different bank-group accesses
-                        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
-                        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                    }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
+    if (seamless_it != queue.end()) {
+        DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
+        return std::make_pair(seamless_it, seamless_col_at);
+    }
 
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
+    // if we have no row hit, prepped or not, and no seamless packet,
+    // just go for the earliest possible
+    auto earliest_it = queue.end();
+    Tick earliest_col_at = MaxTick;
+    bool hidden_bank_prep = false;
+    if (any_miss) {
+        // determine entries with earliest bank delay
+        std::vector<uint32_t> earliest_banks;
+        std::tie(earliest_banks, hidden_bank_prep) =
+            minBankPrep(queue, min_col_at);
+
+        // oldest packet to a closed row of a bank amongst the first
+        // available banks; minBankPrep gives priority to packets that
+        // can issue seamlessly
+        for (int i = 0; i < ranksPerChannel; i++) {
+            for (uint32_t bits = earliest_banks[i]; bits; bits &= bits - 1) {
+                const int j = findLsbSet(bits);
+                const Bank &bank = ranks[i]->banks[j];
+                auto miss = queue.oldestNotInRow(pseudoChannel,
+                                                 i * banksPerRank + j,
+                                                 bank.openRow);
+                if (miss != queue.end() &&
+                    older(miss, earliest_it, queue.end())) {
+                    earliest_it = miss;
+                    earliest_col_at = (*miss)->isRead() ?
+                        bank.rdAllowedAt : bank.wrAllowedAt;
                 }
-            } else {
-                DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                        pkt->bank, pkt->rank);
             }
         }
     }
 
-    if (selected_pkt_it == queue.end()) {
-        DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+    // give priority to packets that can issue bank commands 'behind the
+    // scenes', any additional delay if any will be due to col-to-col
+    // command requirements; otherwise prefer a prepped row hit
+    if (earliest_it != queue.end() &&
+        (hidden_bank_prep || prepped_it == queue.end())) {
+        return std::make_pair(earliest_it, earliest_col_at);
+    }
+    if (prepped_it != queue.end()) {
+        DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
+        return std::make_pair(prepped_it, prepped_col_at);
     }
 
-    return std::make_pair(selected_pkt_it, selected_col_at);
+    DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
+    return std::make_pair(queue.end(), MaxTick);
 }
 
 void
@@ -913,8 +922,9 @@ DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
     // later
     uint16_t bank_id = banksPerRank * rank + bank;
 
-    return new MemPacket(pkt, is_read, true, pseudo_channel, rank, bank, row,
-                   bank_id, pkt_addr, size);
+    return ctrl->packetPool().allocate(pkt, is_read, true, pseudo_channel,
+                                       rank, bank, row, bank_id, pkt_addr,
+                                       size);
 }
 
 void DRAMInterface::setupRank(const uint8_t rank, const bool is_read)
@@ -1041,11 +1051,13 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // determine if we have queued transactions targetting the
     // bank in question
     std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
+    const std::vector<uint64_t> &busy = queue.busyBankMask(pseudoChannel);
+    for (unsigned w = 0; w < busy.size(); w++) {
+        for (uint64_t bits = busy[w]; bits; bits &= bits - 1) {
+            const uint16_t bank_id = w * 64 + findLsbSet(bits);
+            if (ranks[bank_id / banksPerRank]->inRefIdleState())
+                got_waiting[bank_id] = true;
+        }
     }
 
     // Find command with optimal bank timing
@@ -0,0 +1,297 @@
+#include "mem/eventq_boundary.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "sim/simulate.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/**
+ * Runs the calls of a scope as the owner of another event queue, so that
+ * the events they schedule go straight into it. Unlike
+ * EventQueue::ScopedMigration this takes no lock: it is only used when no
+ * queues run in parallel, or at a quantum barrier, where the owner of the
+ * queue waits holding its service lock.
+ */
+class ScopedEventQueue
+{
+  private:
+    EventQueue *const old;
+
+  public:
+    ScopedEventQueue(EventQueue *q)
+        : old(curEventQueue())
+    {
+        curEventQueue(q);
+    }
+
+    ~ScopedEventQueue() { curEventQueue(old); }
+};
+
+bool
+satisfiedBy(PacketPtr pkt, const std::deque<PacketPtr> &queue)
+{
+    return std::any_of(queue.begin(), queue.end(),
+                       [pkt](PacketPtr queued) {
+                           return pkt->trySatisfyFunctional(queued);
+                       });
+}
+
+} // anonymous namespace
+
+std::vector<EventQueueBoundary *> EventQueueBoundary::boundaries;
+bool EventQueueBoundary::exchanging = false;
+
+EventQueueBoundary::EventQueueBoundary(const EventQueueBoundaryParams &p)
+    : SimObject(p),
+      cpuSidePort(p.name + ".cpu_side_port", *this),
+      memSidePort(p.name + ".mem_side_port", *this),
+      cpuSideQueue(getEventQueue(p.cpu_side_eventq_index)),
+      reqLimit(p.req_size)
+{
+    fatal_if(reqLimit == 0, "%s needs room for at least one request.\n",
+             name());
+
+    if (boundaries.empty())
+        registerQuantumCallback(&EventQueueBoundary::exchangeAll);
+    boundaries.push_back(this);
+}
+
+void
+EventQueueBoundary::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Both ports of %s must be connected.\n", name());
+
+    cpuSidePort.sendRangeChange();
+}
+
+Port &
+EventQueueBoundary::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "cpu_side_port") {
+        return cpuSidePort;
+    } else if (if_name == "mem_side_port") {
+        return memSidePort;
+    } else {
+        return SimObject::getPort(if_name, idx);
+    }
+}
+
+void
+EventQueueBoundary::exchangeAll()
+{
+    exchanging = true;
+    for (auto *boundary : boundaries)
+        boundary->exchange();
+    exchanging = false;
+}
+
+void
+EventQueueBoundary::exchange()
+{
+    {
+        ScopedEventQueue mem_side(memSideQueue());
+
+        while (!expressSnoops.empty()) {
+            [[maybe_unused]] bool success =
+                memSidePort.sendTimingReq(expressSnoops.front());
+            // express snoops always succeed
+            assert(success);
+            expressSnoops.pop_front();
+        }
+
+        while (!waitingSnoopRespRetry && !snoopResps.empty()) {
+            if (!memSidePort.sendTimingSnoopResp(snoopResps.front())) {
+                waitingSnoopRespRetry = true;
+                break;
+            }
+            snoopResps.pop_front();
+        }
+
+        while (!waitingReqRetry && !reqs.empty()) {
+            if (!memSidePort.sendTimingReq(reqs.front())) {
+                waitingReqRetry = true;
+                break;
+            }
+            reqs.pop_front();
+        }
+    }
+
+    {
+        ScopedEventQueue cpu_side(cpuSideQueue);
+
+        while (!waitingRespRetry && !resps.empty()) {
+            if (!cpuSidePort.sendTimingResp(resps.front())) {
+                waitingRespRetry = true;
+                break;
+            }
+            resps.pop_front();
+        }
+
+        // requests sent in reply to the retry wait for the next barrier
+        if (retryReq && reqs.size() < reqLimit) {
+            retryReq = false;
+            cpuSidePort.sendRetryReq();
+        }
+    }
+
+    if (drainState() == DrainState::Draining && idle())
+        signalDrainDone();
+}
+
+void
+EventQueueBoundary::checkSynchronous(const char *what) const
+{
+    fatal_if(inParallelMode && !exchanging,
+             "%s: %s across event queues that run in parallel; only timing "
+             "requests and responses can wait for the quantum barrier.\n",
+             name(), what);
+}
+
+bool
+EventQueueBoundary::idle() const
+{
+    return reqs.empty() && expressSnoops.empty() && snoopResps.empty() &&
+        resps.empty() && !retryReq;
+}
+
+DrainState
+EventQueueBoundary::drain()
+{
+    return idle() ? DrainState::Drained : DrainState::Draining;
+}
+
+bool
+EventQueueBoundary::CpuSidePort::recvTimingReq(PacketPtr pkt)
+{
+    if (pkt->isExpressSnoop()) {
+        boundary.expressSnoops.push_back(pkt);
+        return true;
+    }
+
+    if (boundary.retryReq || boundary.reqs.size() == boundary.reqLimit) {
+        boundary.retryReq = true;
+        return false;
+    }
+
+    boundary.reqs.push_back(pkt);
+    return true;
+}
+
+bool
+EventQueueBoundary::CpuSidePort::tryTiming(PacketPtr pkt)
+{
+    return pkt->isExpressSnoop() ||
+        (!boundary.retryReq && boundary.reqs.size() < boundary.reqLimit);
+}
+
+bool
+EventQueueBoundary::CpuSidePort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    boundary.snoopResps.push_back(pkt);
+    return true;
+}
+
+void
+EventQueueBoundary::CpuSidePort::recvRespRetry()
+{
+    boundary.waitingRespRetry = false;
+}
+
+Tick
+EventQueueBoundary::CpuSidePort::recvAtomic(PacketPtr pkt)
+{
+    boundary.checkSynchronous("atomic access");
+    ScopedEventQueue mem_side(boundary.memSideQueue());
+    return boundary.memSidePort.sendAtomic(pkt);
+}
+
+void
+EventQueueBoundary::CpuSidePort::recvFunctional(PacketPtr pkt)
+{
+    boundary.checkSynchronous("functional access");
+
+    pkt->pushLabel(name());
+
+    if (satisfiedBy(pkt, boundary.resps) ||
+        satisfiedBy(pkt, boundary.snoopResps) ||
+        satisfiedBy(pkt, boundary.reqs)) {
+        pkt->makeResponse();
+        return;
+    }
+
+    pkt->popLabel();
+
+    ScopedEventQueue mem_side(boundary.memSideQueue());
+    boundary.memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+EventQueueBoundary::CpuSidePort::getAddrRanges() const
+{
+    return boundary.memSidePort.getAddrRanges();
+}
+
+bool
+EventQueueBoundary::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    boundary.resps.push_back(pkt);
+    return true;
+}
+
+void
+EventQueueBoundary::MemSidePort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // the crossbar reads the snoop result when this call returns
+    boundary.checkSynchronous("timing snoop");
+    ScopedEventQueue cpu_side(boundary.cpuSideQueue);
+    boundary.cpuSidePort.sendTimingSnoopReq(pkt);
+}
+
+void
+EventQueueBoundary::MemSidePort::recvReqRetry()
+{
+    boundary.waitingReqRetry = false;
+}
+
+void
+EventQueueBoundary::MemSidePort::recvRetrySnoopResp()
+{
+    boundary.waitingSnoopRespRetry = false;
+}
+
+Tick
+EventQueueBoundary::MemSidePort::recvAtomicSnoop(PacketPtr pkt)
+{
+    boundary.checkSynchronous("atomic snoop");
+    ScopedEventQueue cpu_side(boundary.cpuSideQueue);
+    return boundary.cpuSidePort.sendAtomicSnoop(pkt);
+}
+
+void
+EventQueueBoundary::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    boundary.checkSynchronous("functional snoop");
+    ScopedEventQueue cpu_side(boundary.cpuSideQueue);
+    boundary.cpuSidePort.sendFunctionalSnoop(pkt);
+}
+
+void
+EventQueueBoundary::MemSidePort::recvRangeChange()
+{
+    boundary.cpuSidePort.sendRangeChange();
+}
+
+bool
+EventQueueBoundary::MemSidePort::isSnooping() const
+{
+    return boundary.cpuSidePort.isSnooping();
+}
+
+} // namespace gem5
@@ -0,0 +1,160 @@
+/**
+ * @file
+ * Port forwarder placed where the memory system crosses from one event
+ * queue to another in a parallel (multi-queue) simulation.
+ */
+
+#ifndef __MEM_EVENTQ_BOUNDARY_HH__
+#define __MEM_EVENTQ_BOUNDARY_HH__
+
+#include <deque>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "mem/port.hh"
+#include "params/EventQueueBoundary.hh"
+#include "sim/drain.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Objects on different event queues are serviced by different host
+ * threads, so neither side of the boundary may call into the other while
+ * the queues run. Timing packets are buffered on the side that receives
+ * them and handed over at the next quantum barrier, where one thread
+ * runs every boundary in turn while the others wait (see
+ * registerQuantumCallback()). Within that window a call may reach any
+ * object, so a packet forwarded to the coherent crossbar below gets its
+ * snoops answered by the L2s of the other boundaries inside the same
+ * call, as the crossbar expects.
+ *
+ * A crossing therefore takes until the next quantum barrier, and the set
+ * of packets crossing at a barrier does not depend on host thread timing.
+ * The single queue run of the same configuration stops at the same
+ * quanta and moves the same packets, which makes it a reference for the
+ * stats of the parallel run.
+ *
+ * Express snoops sent down by the L2 always succeed and only cross at the
+ * barrier too. Snoops, atomic and functional accesses cannot wait for a
+ * barrier, so they are forwarded directly when no queues run in parallel
+ * or at the barrier, and are fatal otherwise.
+ *
+ * The boundary belongs to the memory side queue; the objects on the CPU
+ * side belong to cpu_side_eventq_index.
+ */
+class EventQueueBoundary : public SimObject
+{
+  private:
+    class CpuSidePort : public ResponsePort
+    {
+      private:
+        EventQueueBoundary &boundary;
+
+      public:
+        CpuSidePort(const std::string &_name, EventQueueBoundary &_boundary)
+            : ResponsePort(_name, &_boundary), boundary(_boundary)
+        {}
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        bool tryTiming(PacketPtr pkt) override;
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class MemSidePort : public RequestPort
+    {
+      private:
+        EventQueueBoundary &boundary;
+
+      public:
+        MemSidePort(const std::string &_name, EventQueueBoundary &_boundary)
+            : RequestPort(_name, &_boundary), boundary(_boundary)
+        {}
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRetrySnoopResp() override;
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+        void recvRangeChange() override;
+        bool isSnooping() const override;
+    };
+
+    CpuSidePort cpuSidePort;
+    MemSidePort memSidePort;
+
+    /** Queue owning the objects connected to the CPU side port. */
+    EventQueue *const cpuSideQueue;
+
+    /** Queue owning the objects connected to the memory side port. */
+    EventQueue *memSideQueue() const { return eventQueue(); }
+
+    /** Requests buffered at most between two barriers. */
+    const unsigned reqLimit;
+
+    /**
+     * Written by the CPU side thread during a quantum, and emptied at the
+     * barrier.
+     */
+    /** @{ */
+    std::deque<PacketPtr> reqs;
+    std::deque<PacketPtr> expressSnoops;
+    std::deque<PacketPtr> snoopResps;
+    bool retryReq = false;
+    bool waitingRespRetry = false;
+    /** @} */
+
+    /**
+     * Written by the memory side thread during a quantum, and emptied at
+     * the barrier.
+     */
+    /** @{ */
+    std::deque<PacketPtr> resps;
+    bool waitingReqRetry = false;
+    bool waitingSnoopRespRetry = false;
+    /** @} */
+
+    /** All boundaries, in the order they exchange at a barrier. */
+    static std::vector<EventQueueBoundary *> boundaries;
+
+    /** True while the boundaries exchange at a barrier. */
+    static bool exchanging;
+
+    /** Run at every quantum barrier. */
+    static void exchangeAll();
+
+    /** Hand the buffered packets of both sides over to the other side. */
+    void exchange();
+
+    /**
+     * Fatal if a call that needs an answer at once would reach another
+     * thread's objects.
+     */
+    void checkSynchronous(const char *what) const;
+
+    bool idle() const;
+
+  public:
+    EventQueueBoundary(const EventQueueBoundaryParams &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    DrainState drain() override;
+};
+
+} // namespace gem5
+
+#endif // __MEM_EVENTQ_BOUNDARY_HH__
@@ -333,27 +333,13 @@ HBMCtrl::recvTimingReq(PacketPtr pkt)
 void
 HBMCtrl::pruneRowBurstTick()
 {
-    auto it = rowBurstTicks.begin();
-    while (it != rowBurstTicks.end()) {
-        auto current_it = it++;
-        if (MemCtrl::getBurstWindow(curTick()) > *current_it) {
-            DPRINTF(MemCtrl, "Removing burstTick for %d\n", *current_it);
-            rowBurstTicks.erase(current_it);
-        }
-    }
+    pruneBurstTicks(rowBurstTicks, MemCtrl::getBurstWindow(curTick()));
 }
 
 void
 HBMCtrl::pruneColBurstTick()
 {
-    auto it = colBurstTicks.begin();
-    while (it != colBurstTicks.end()) {
-        auto current_it = it++;
-        if (MemCtrl::getBurstWindow(curTick()) > *current_it) {
-            DPRINTF(MemCtrl, "Removing burstTick for %d\n", *current_it);
-            colBurstTicks.erase(current_it);
-        }
-    }
+    pruneBurstTicks(colBurstTicks, MemCtrl::getBurstWindow(curTick()));
 }
 
 void
@@ -376,7 +362,8 @@ HBMCtrl::verifySingleCmd(Tick cmd_tick, Tick max_cmds_per_burst, bool row_cmd)
     // if not, iterate over next window(s) until slot found
 
     if (row_cmd) {
-        while (rowBurstTicks.count(burst_tick) >= max_cmds_per_burst) {
+        while (cmdsInBurst(rowBurstTicks, burst_tick) >=
+               max_cmds_per_burst) {
             DPRINTF(MemCtrl, "Contention found on row command bus at %d\n",
                     burst_tick);
             burst_tick += commandWindow;
@@ -384,10 +371,11 @@ HBMCtrl::verifySingleCmd(Tick cmd_tick, Tick max_cmds_per_burst, bool row_cmd)
         }
         DPRINTF(MemCtrl, "Now can send a row cmd_at %d\n",
                     cmd_at);
-        rowBurstTicks.insert(burst_tick);
+        ++rowBurstTicks[burst_tick];
 
     } else {
-        while (colBurstTicks.count(burst_tick) >= max_cmds_per_burst) {
+        while (cmdsInBurst(colBurstTicks, burst_tick) >=
+               max_cmds_per_burst) {
             DPRINTF(MemCtrl, "Contention found on col command bus at %d\n",
                     burst_tick);
             burst_tick += commandWindow;
@@ -395,7 +383,7 @@ HBMCtrl::verifySingleCmd(Tick cmd_tick, Tick max_cmds_per_burst, bool row_cmd)
         }
         DPRINTF(MemCtrl, "Now can send a col cmd_at %d\n",
                     cmd_at);
-        colBurstTicks.insert(burst_tick);
+        ++colBurstTicks[burst_tick];
     }
     return cmd_at;
 }
@@ -431,9 +419,10 @@ HBMCtrl::verifyMultiCmd(Tick cmd_tick, Tick max_cmds_per_burst,
     // verify that we have command bandwidth to issue the command(s)
     while (!first_can_issue || !second_can_issue) {
         bool same_burst = (burst_tick == first_cmd_tick);
-        auto first_cmd_count = rowBurstTicks.count(first_cmd_tick);
+        auto first_cmd_count = cmdsInBurst(rowBurstTicks, first_cmd_tick);
         auto second_cmd_count = same_burst ?
-                        first_cmd_count + 1 : rowBurstTicks.count(burst_tick);
+                        first_cmd_count + 1 :
+                        cmdsInBurst(rowBurstTicks, burst_tick);
 
         first_can_issue = first_cmd_count < max_cmds_per_burst;
         second_can_issue = second_cmd_count < max_cmds_per_burst;
@@ -459,8 +448,8 @@ HBMCtrl::verifyMultiCmd(Tick cmd_tick, Tick max_cmds_per_burst,
     }
 
     // Add command to burstTicks
-    rowBurstTicks.insert(burst_tick);
-    rowBurstTicks.insert(first_cmd_tick);
+    ++rowBurstTicks[burst_tick];
+    ++rowBurstTicks[first_cmd_tick];
 
     return cmd_at;
 }
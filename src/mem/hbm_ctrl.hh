@@ -34,7 +34,6 @@
 #ifndef __HBM_CTRL_HH__
 #define __HBM_CTRL_HH__
 
-#include <deque>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -171,21 +170,21 @@ class HBMCtrl : public MemCtrl
      * Response queue for pkts sent to second pseudo channel
      * The first pseudo channel uses MemCtrl::respQueue
      */
-    std::deque<MemPacket*> respQueuePC1;
+    MemRespQueue respQueuePC1;
 
     /**
      * Holds count of row commands issued in burst window starting at
      * defined Tick. This is used to ensure that the row command bandwidth
      * does not exceed the allowable media constraints.
      */
-    std::unordered_multiset<Tick> rowBurstTicks;
+    BurstTicks rowBurstTicks;
 
     /**
      * This is used to ensure that the column command bandwidth
      * does not exceed the allowable media constraints. HBM2 has separate
      * command bus for row and column commands
      */
-    std::unordered_multiset<Tick> colBurstTicks;
+    BurstTicks colBurstTicks;
 
     /**
      * Pointers to interfaces of the two pseudo channels
@@ -194,7 +194,7 @@ HeteroMemCtrl::recvTimingReq(PacketPtr pkt)
 
 void
 HeteroMemCtrl::processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        MemRespQueue& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
@@ -57,6 +57,105 @@ namespace gem5
 namespace memory
 {
 
+void
+MemPacketQueue::push_back(MemPacket *pkt)
+{
+    pkt->queueSeq = nextSeq++;
+    packets.push_back(pkt);
+    if (!pkt->isDram())
+        return;
+
+    if (banks.size() <= pkt->pseudoChannel) {
+        banks.resize(pkt->pseudoChannel + 1);
+        busyBanks.resize(pkt->pseudoChannel + 1);
+    }
+    auto &pc_banks = banks[pkt->pseudoChannel];
+    if (pc_banks.size() <= pkt->bankId)
+        pc_banks.resize(pkt->bankId + 1);
+    auto &busy = busyBanks[pkt->pseudoChannel];
+    if (busy.size() <= pkt->bankId / 64)
+        busy.resize(pkt->bankId / 64 + 1, 0);
+
+    BankQueue &bank = pc_banks[pkt->bankId];
+    bank.all.push_back(pkt);
+    bank.rows[pkt->row].push_back(pkt);
+    busy[pkt->bankId / 64] |= 1ULL << (pkt->bankId % 64);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator it)
+{
+    MemPacket *pkt = *it;
+    if (pkt->isDram()) {
+        BankQueue &bank = banks[pkt->pseudoChannel][pkt->bankId];
+        bank.all.erase(BankList::iterator(pkt));
+        bank.rows[pkt->row].erase(RowList::iterator(pkt));
+        if (bank.all.empty()) {
+            busyBanks[pkt->pseudoChannel][pkt->bankId / 64] &=
+                ~(1ULL << (pkt->bankId % 64));
+            if (bank.rows.size() > maxIdleRows)
+                bank.rows.clear();
+        }
+    }
+    return packets.erase(it);
+}
+
+const MemPacketQueue::BankQueue *
+MemPacketQueue::bankQueue(uint8_t pseudo_channel, uint16_t bank_id) const
+{
+    if (banks.size() <= pseudo_channel ||
+        banks[pseudo_channel].size() <= bank_id) {
+        return nullptr;
+    }
+    return &banks[pseudo_channel][bank_id];
+}
+
+const std::vector<uint64_t> &
+MemPacketQueue::busyBankMask(uint8_t pseudo_channel) const
+{
+    static const std::vector<uint64_t> none;
+    return busyBanks.size() > pseudo_channel ? busyBanks[pseudo_channel] :
+        none;
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::oldestInRow(uint8_t pseudo_channel, uint16_t bank_id,
+                            uint32_t row) const
+{
+    const BankQueue *bank = bankQueue(pseudo_channel, bank_id);
+    if (!bank)
+        return end();
+    auto it = bank->rows.find(row);
+    if (it == bank->rows.end() || it->second.empty())
+        return end();
+    return iterator(it->second.front());
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::oldestNotInRow(uint8_t pseudo_channel, uint16_t bank_id,
+                               uint32_t row) const
+{
+    const BankQueue *bank = bankQueue(pseudo_channel, bank_id);
+    if (!bank)
+        return end();
+    for (MemPacket *pkt : bank->all) {
+        if (pkt->row != row)
+            return iterator(pkt);
+    }
+    return end();
+}
+
+void
+MemPacketPool::grow()
+{
+    slabs.emplace_back(new Slot[slabSlots]);
+    Slot *slab = slabs.back().get();
+    for (size_t i = 0; i < slabSlots; i++) {
+        slab[i].nextFree = freeList;
+        freeList = &slab[i];
+    }
+}
+
 MemCtrl::MemCtrl(const MemCtrlParams &p) :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
@@ -480,7 +579,7 @@ MemCtrl::recvTimingReq(PacketPtr pkt)
 
 void
 MemCtrl::processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        MemRespQueue& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req)
 {
@@ -537,7 +636,7 @@ MemCtrl::processRespondEvent(MemInterface* mem_intr,
         }
     }
 
-    delete mem_pkt;
+    memPacketPool.release(mem_pkt);
 
     // We have made a location in the queue available at this point,
     // so if there is a read that was forced to wait, retry now
@@ -652,14 +751,7 @@ MemCtrl::accessAndRespond(PacketPtr pkt, Tick static_latency,
 void
 MemCtrl::pruneBurstTick()
 {
-    auto it = burstTicks.begin();
-    while (it != burstTicks.end()) {
-        auto current_it = it++;
-        if (curTick() > *current_it) {
-            DPRINTF(MemCtrl, "Removing burstTick for %d\n", *current_it);
-            burstTicks.erase(current_it);
-        }
-    }
+    pruneBurstTicks(burstTicks, curTick());
 }
 
 Tick
@@ -681,7 +773,7 @@ MemCtrl::verifySingleCmd(Tick cmd_tick, Tick max_cmds_per_burst, bool row_cmd)
 
     // verify that we have command bandwidth to issue the command
     // if not, iterate over next window(s) until slot found
-    while (burstTicks.count(burst_tick) >= max_cmds_per_burst) {
+    while (cmdsInBurst(burstTicks, burst_tick) >= max_cmds_per_burst) {
         DPRINTF(MemCtrl, "Contention found on command bus at %d\n",
                 burst_tick);
         burst_tick += commandWindow;
@@ -689,7 +781,7 @@ MemCtrl::verifySingleCmd(Tick cmd_tick, Tick max_cmds_per_burst, bool row_cmd)
     }
 
     // add command into burst window and return corresponding Tick
-    burstTicks.insert(burst_tick);
+    ++burstTicks[burst_tick];
     return cmd_at;
 }
 
@@ -723,9 +815,9 @@ MemCtrl::verifyMultiCmd(Tick cmd_tick, Tick max_cmds_per_burst,
     // verify that we have command bandwidth to issue the command(s)
     while (!first_can_issue || !second_can_issue) {
         bool same_burst = (burst_tick == first_cmd_tick);
-        auto first_cmd_count = burstTicks.count(first_cmd_tick);
+        auto first_cmd_count = cmdsInBurst(burstTicks, first_cmd_tick);
         auto second_cmd_count = same_burst ? first_cmd_count + 1 :
-                                   burstTicks.count(burst_tick);
+                                   cmdsInBurst(burstTicks, burst_tick);
 
         first_can_issue = first_cmd_count < max_cmds_per_burst;
         second_can_issue = second_cmd_count < max_cmds_per_burst;
@@ -751,8 +843,8 @@ MemCtrl::verifyMultiCmd(Tick cmd_tick, Tick max_cmds_per_burst,
     }
 
     // Add command to burstTicks
-    burstTicks.insert(burst_tick);
-    burstTicks.insert(first_cmd_tick);
+    ++burstTicks[burst_tick];
+    ++burstTicks[first_cmd_tick];
 
     return cmd_at;
 }
@@ -870,7 +962,7 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
 
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
-                        MemPacketQueue& resp_queue,
+                        MemRespQueue& resp_queue,
                         EventFunctionWrapper& resp_event,
                         EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
@@ -1093,7 +1185,7 @@ MemCtrl::processNextReqEvent(MemInterface* mem_intr,
         // remove the request from the queue - the iterator is no longer valid
         writeQueue[mem_pkt->qosValue()].erase(to_write);
 
-        delete mem_pkt;
+        memPacketPool.release(mem_pkt);
 
         // If we emptied the write queue, or got sufficiently below the
         // threshold (using the minWritesPerSwitch as the hysteresis) and
@@ -46,8 +46,12 @@
 #ifndef __MEM_CTRL_HH__
 #define __MEM_CTRL_HH__
 
-#include <deque>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -156,6 +160,31 @@ class MemPacket
      */
     uint8_t _qosValue;
 
+    /**
+     * Arrival order in the MemPacketQueue holding this packet, set when
+     * it is queued
+     */
+    uint64_t queueSeq = 0;
+
+    /** Links of an intrusive MemPacketList. */
+    struct Link
+    {
+        MemPacket *prev = nullptr;
+        MemPacket *next = nullptr;
+    };
+
+    /** Links in the read or write queue, in arrival order */
+    Link queueLink;
+
+    /** Links in the queued packets to the same bank, in arrival order */
+    Link bankLink;
+
+    /** Links in the queued packets to the same row, in arrival order */
+    Link rowLink;
+
+    /** Links in the response queue */
+    Link respLink;
+
     /**
      * Set the packet QoS value
      * (interface compatibility with Packet)
@@ -215,9 +244,252 @@ class MemPacket
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
+/**
+ * A list of memory packets linked through one of their Links, so a
+ * packet can sit in several lists at once and queueing it neither
+ * allocates nor frees.
+ */
+template <MemPacket::Link MemPacket::*L>
+class MemPacketList
+{
+  private:
+    MemPacket *head = nullptr;
+    MemPacket *tail = nullptr;
+    size_t count = 0;
+
+  public:
+    class iterator
+    {
+      private:
+        MemPacket *pkt = nullptr;
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef MemPacket *value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef MemPacket **pointer;
+        typedef MemPacket *reference;
+
+        iterator() = default;
+        explicit iterator(MemPacket *_pkt) : pkt(_pkt) {}
+
+        MemPacket *operator*() const { return pkt; }
+
+        iterator &
+        operator++()
+        {
+            pkt = (pkt->*L).next;
+            return *this;
+        }
+
+        iterator
+        operator++(int)
+        {
+            iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const iterator &other) const
+        { return pkt == other.pkt; }
+        bool operator!=(const iterator &other) const
+        { return pkt != other.pkt; }
+    };
+    typedef iterator const_iterator;
+
+    MemPacketList() = default;
+    MemPacketList(const MemPacketList &) = delete;
+    MemPacketList &operator=(const MemPacketList &) = delete;
+
+    MemPacketList(MemPacketList &&other) noexcept
+        : head(other.head), tail(other.tail), count(other.count)
+    {
+        other.head = other.tail = nullptr;
+        other.count = 0;
+    }
+
+    MemPacketList &
+    operator=(MemPacketList &&other) noexcept
+    {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(count, other.count);
+        return *this;
+    }
+
+    iterator begin() const { return iterator(head); }
+    iterator end() const { return iterator(); }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    MemPacket *front() const { return head; }
+    MemPacket *back() const { return tail; }
+
+    void
+    push_back(MemPacket *pkt)
+    {
+        MemPacket::Link &link = pkt->*L;
+        link.prev = tail;
+        link.next = nullptr;
+        if (tail)
+            (tail->*L).next = pkt;
+        else
+            head = pkt;
+        tail = pkt;
+        count++;
+    }
+
+    /** Unlink a packet, returning the one after it. */
+    iterator
+    erase(iterator it)
+    {
+        MemPacket *pkt = *it;
+        MemPacket::Link &link = pkt->*L;
+        if (link.prev)
+            (link.prev->*L).next = link.next;
+        else
+            head = link.next;
+        if (link.next)
+            (link.next->*L).prev = link.prev;
+        else
+            tail = link.prev;
+        MemPacket *next = link.next;
+        link.prev = link.next = nullptr;
+        count--;
+        return iterator(next);
+    }
+
+    void pop_front() { erase(begin()); }
+};
+
+/** Packets waiting for their response to be sent, by ready time. */
+typedef MemPacketList<&MemPacket::respLink> MemRespQueue;
+
+/**
+ * The memory packets of one QoS priority, in arrival order. DRAM packets
+ * are also linked per pseudo channel and bank, and per row within their
+ * bank, so that FR-FCFS finds the oldest row hit of a bank directly and
+ * the oldest packet to another row by walking only the packets to that
+ * bank. The memory packets are stored in one of these per QoS priority.
+ */
+class MemPacketQueue
+{
+  private:
+    typedef MemPacketList<&MemPacket::bankLink> BankList;
+    typedef MemPacketList<&MemPacket::rowLink> RowList;
+
+    /** The DRAM packets to one bank, all of them and per row. */
+    struct BankQueue
+    {
+        BankList all;
+
+        /**
+         * Rows stay in the map once empty, so queueing to a row seen
+         * before does not allocate. They are dropped when the bank
+         * drains with more than maxIdleRows of them.
+         */
+        std::unordered_map<uint32_t, RowList> rows;
+    };
+
+    static constexpr size_t maxIdleRows = 16;
+
+    MemPacketList<&MemPacket::queueLink> packets;
+
+    /** DRAM packets, indexed by pseudo channel, then bank id. */
+    std::vector<std::vector<BankQueue>> banks;
+
+    /** Per pseudo channel, a bitmap of the bank ids with DRAM packets. */
+    std::vector<std::vector<uint64_t>> busyBanks;
+
+    uint64_t nextSeq = 0;
+
+    const BankQueue *bankQueue(uint8_t pseudo_channel,
+                               uint16_t bank_id) const;
+
+  public:
+    typedef MemPacketList<&MemPacket::queueLink>::iterator iterator;
+    typedef iterator const_iterator;
+
+    MemPacketQueue() = default;
+    MemPacketQueue(const MemPacketQueue &) = delete;
+    MemPacketQueue(MemPacketQueue &&) = default;
+    MemPacketQueue &operator=(const MemPacketQueue &) = delete;
+    MemPacketQueue &operator=(MemPacketQueue &&) = default;
+
+    iterator begin() const { return packets.begin(); }
+    iterator end() const { return packets.end(); }
+
+    size_t size() const { return packets.size(); }
+    bool empty() const { return packets.empty(); }
+    MemPacket *front() const { return packets.front(); }
+    MemPacket *back() const { return packets.back(); }
+
+    void push_back(MemPacket *pkt);
+    iterator erase(iterator it);
+    void pop_front() { erase(begin()); }
+
+    /**
+     * Bitmap, over bank ids, of the banks of a pseudo channel that have
+     * DRAM packets queued.
+     */
+    const std::vector<uint64_t> &busyBankMask(uint8_t pseudo_channel) const;
+
+    /** Oldest DRAM packet to a bank and row, or end() if none. */
+    iterator oldestInRow(uint8_t pseudo_channel, uint16_t bank_id,
+                         uint32_t row) const;
+
+    /** Oldest DRAM packet to a bank but not to a row, or end() if none. */
+    iterator oldestNotInRow(uint8_t pseudo_channel, uint16_t bank_id,
+                            uint32_t row) const;
+};
+
+/**
+ * Free list of memory packets owned by a controller. A controller makes
+ * and destroys one per burst, so recycle their storage rather than going
+ * to the heap each time.
+ */
+class MemPacketPool
+{
+  private:
+    union Slot
+    {
+        Slot *nextFree;
+        alignas(MemPacket) unsigned char storage[sizeof(MemPacket)];
+    };
+
+    /** Slots allocated at once when the free list runs dry */
+    static constexpr size_t slabSlots = 64;
+
+    std::vector<std::unique_ptr<Slot[]>> slabs;
+    Slot *freeList = nullptr;
+
+    void grow();
+
+  public:
+    MemPacketPool() = default;
+    MemPacketPool(const MemPacketPool &) = delete;
+    MemPacketPool &operator=(const MemPacketPool &) = delete;
+
+    template <typename... Args>
+    MemPacket *
+    allocate(Args&&... args)
+    {
+        if (!freeList)
+            grow();
+        Slot *slot = freeList;
+        freeList = slot->nextFree;
+        return new (slot->storage) MemPacket(std::forward<Args>(args)...);
+    }
+
+    void
+    release(MemPacket *pkt)
+    {
+        pkt->~MemPacket();
+        Slot *slot = reinterpret_cast<Slot *>(pkt);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+};
 
 
 /**
@@ -297,14 +569,14 @@ class MemCtrl : public qos::MemCtrl
      * in these methods
      */
     virtual void processNextReqEvent(MemInterface* mem_intr,
-                          MemPacketQueue& resp_queue,
+                          MemRespQueue& resp_queue,
                           EventFunctionWrapper& resp_event,
                           EventFunctionWrapper& next_req_event,
                           bool& retry_wr_req);
     EventFunctionWrapper nextReqEvent;
 
     virtual void processRespondEvent(MemInterface* mem_intr,
-                        MemPacketQueue& queue,
+                        MemRespQueue& queue,
                         EventFunctionWrapper& resp_event,
                         bool& retry_rd_req);
     EventFunctionWrapper respondEvent;
@@ -486,14 +758,37 @@ class MemCtrl : public qos::MemCtrl
      * as sizing the read queue, this and the main read queue need to
      * be added together.
      */
-    std::deque<MemPacket*> respQueue;
+    MemRespQueue respQueue;
+
+    /**
+     * Storage for the memory packets of this controller and its
+     * interfaces
+     */
+    MemPacketPool memPacketPool;
+
+    /** Count of commands issued in each burst window, by its start. */
+    typedef std::map<Tick, unsigned> BurstTicks;
 
     /**
      * Holds count of commands issued in burst window starting at
      * defined Tick. This is used to ensure that the command bandwidth
      * does not exceed the allowable media constraints.
      */
-    std::unordered_multiset<Tick> burstTicks;
+    BurstTicks burstTicks;
+
+    static unsigned
+    cmdsInBurst(const BurstTicks &ticks, Tick burst_tick)
+    {
+        auto it = ticks.find(burst_tick);
+        return it == ticks.end() ? 0 : it->second;
+    }
+
+    /** Forget the burst windows starting before a Tick. */
+    static void
+    pruneBurstTicks(BurstTicks &ticks, Tick before)
+    {
+        ticks.erase(ticks.begin(), ticks.lower_bound(before));
+    }
 
     /**
 +    * Create pointer to interface of the actual memory media when connected
@@ -676,6 +971,9 @@ class MemCtrl : public qos::MemCtrl
 
     MemCtrl(const MemCtrlParams &p);
 
+    /** Where interfaces allocate the memory packets they decode. */
+    MemPacketPool &packetPool() { return memPacketPool; }
+
     /**
      * Ensure that all interfaced have drained commands
      *
@@ -200,8 +200,9 @@ NVMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
     // later
     uint16_t bank_id = banksPerRank * rank + bank;
 
-    return new MemPacket(pkt, is_read, false, pseudo_channel, rank, bank, row,
-                   bank_id, pkt_addr, size);
+    return ctrl->packetPool().allocate(pkt, is_read, false, pseudo_channel,
+                                       rank, bank, row, bank_id, pkt_addr,
+                                       size);
 }
 
 std::pair<MemPacketQueue::iterator, Tick>
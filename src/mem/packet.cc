@@ -287,26 +287,12 @@ Packet::trySatisfyFunctional(Printable *obj, Addr addr, bool is_secure, int size
         // initialise the tracking of valid bytes if we have not
         // used it already
         if (bytesValid.empty())
-            bytesValid.resize(getSize(), false);
+            bytesValid.resize(getSize());
 
-        // track if we are done filling the functional access
-        bool all_bytes_valid = true;
-
-        int i = 0;
-
-        // check up to func_offset
-        for (; all_bytes_valid && i < func_offset; ++i)
-            all_bytes_valid &= bytesValid[i];
-
-        // update the valid bytes
-        for (i = func_offset; i < func_offset + overlap_size; ++i)
-            bytesValid[i] = true;
-
-        // check the bit after the update we just made
-        for (; all_bytes_valid && i < getSize(); ++i)
-            all_bytes_valid &= bytesValid[i];
-
-        return all_bytes_valid;
+        // update the valid bytes, we are done filling the functional
+        // access once all of them are
+        bytesValid.set(func_offset, overlap_size, true);
+        return bytesValid.all();
     } else if (isWrite()) {
         std::memcpy(_data + val_offset,
                getConstPtr<uint8_t>() + func_offset,
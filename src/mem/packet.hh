@@ -59,6 +59,7 @@
 #include "base/logging.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
+#include "mem/byte_enable.hh"
 #include "mem/htm.hh"
 #include "mem/request.hh"
 #include "sim/byteswap.hh"
@@ -404,7 +405,7 @@ class Packet : public Printable
     /**
      * Track the bytes found that satisfy a functional read.
      */
-    std::vector<bool> bytesValid;
+    ByteEnableMask<> bytesValid;
 
     // Quality of Service priority value
     uint8_t _qosValue;
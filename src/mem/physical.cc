@@ -39,6 +39,7 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/user.h>
 #include <unistd.h>
@@ -87,6 +88,7 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
+                               bool shared_backstore_cow,
                                bool restore_from_gcpt,
                                const std::string& gcpt_restorer_path,
                                const std::string& gcpt_path,
@@ -97,6 +99,7 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                bool enable_mem_dedup) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
+    sharedBackstoreCow(shared_backstore_cow),
     pageSize(sysconf(_SC_PAGE_SIZE)),
     restoreFromXiangshanCpt(restore_from_gcpt),
     gCptRestorerPath(gcpt_restorer_path),
@@ -109,6 +112,11 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
         registerExitCallback([=]() { shm_unlink(shared_backstore.c_str()); });
     }
 
+    fatal_if(sharedBackstoreCow && sharedBackstore.empty(),
+             "A copy-on-write backstore needs a shared_backstore name.\n");
+    fatal_if(sharedBackstoreCow && mapToRawCpt,
+             "A copy-on-write shared backstore cannot map a raw checkpoint.\n");
+
     if (mmap_using_noreserve)
         warn("Not reserving swap space. May cause SIGSEGV on actual usage\n");
 
@@ -247,12 +255,29 @@ PhysicalMemory::createBackingStore(
         sharedBackstoreSize += roundUp(range.size(), pageSize);
         DPRINTF(AddrRanges, "Sharing backing store as %s at offset %llu\n",
                 sharedBackstore.c_str(), (uint64_t)map_offset);
-        shm_fd = shm_open(sharedBackstore.c_str(), O_CREAT | O_RDWR, 0666);
-        if (shm_fd == -1)
-               panic("Shared memory failed");
-        if (ftruncate(shm_fd, sharedBackstoreSize))
-               panic("Setting size of shared memory failed");
-        map_flags = MAP_SHARED;
+        if (sharedBackstoreCow) {
+            // the segment was populated by another process; writes stay
+            // private to this one
+            shm_fd = shm_open(sharedBackstore.c_str(), O_RDONLY, 0);
+            fatal_if(shm_fd == -1, "Can't open shared backstore %s, it must "
+                     "be populated before it is mapped copy-on-write.\n",
+                     sharedBackstore);
+            struct stat st;
+            fatal_if(fstat(shm_fd, &st) ||
+                     (uint64_t)st.st_size < sharedBackstoreSize,
+                     "Shared backstore %s is smaller than the %d bytes this "
+                     "memory layout needs.\n", sharedBackstore,
+                     sharedBackstoreSize);
+            map_flags = MAP_PRIVATE;
+        } else {
+            shm_fd = shm_open(sharedBackstore.c_str(), O_CREAT | O_RDWR,
+                              0666);
+            if (shm_fd == -1)
+                   panic("Shared memory failed");
+            if (ftruncate(shm_fd, sharedBackstoreSize))
+                   panic("Setting size of shared memory failed");
+            map_flags = MAP_SHARED;
+        }
     }
 
     // to be able to simulate very large memories, the user can opt to
@@ -845,6 +870,11 @@ PhysicalMemory::tryRestoreFromXSCpt()
     if (!restoreFromXiangshanCpt) {
         return false;
     }
+    if (sharedBackstoreCow) {
+        inform("Using the checkpoint already restored in %s\n",
+               sharedBackstore);
+        return true;
+    }
     unserializeStoreFromFile(xsCptPath);
     return true;
 }
@@ -162,6 +162,9 @@ class PhysicalMemory : public Serializable
     const std::string sharedBackstore;
     uint64_t sharedBackstoreSize;
 
+    // Map an existing, already restored shared backstore privately
+    const bool sharedBackstoreCow;
+
     long pageSize;
 
     // The physical memory used to provide the memory in the simulated
@@ -218,6 +221,7 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
+                   bool shared_backstore_cow,
                    bool restore_from_gcpt,
                    const std::string& gcpt_restorer_path,
                    const std::string&gcpt_path,
@@ -62,6 +62,7 @@
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/dyn_inst_xsmeta.hh"
+#include "mem/byte_enable.hh"
 #include "mem/htm.hh"
 #include "sim/cur_tick.hh"
 
@@ -456,7 +457,7 @@ class Request
     unsigned _size = 0;
 
     /** Byte-enable mask for writes. */
-    std::vector<bool> _byteEnable;
+    ByteEnable _byteEnable;
 
     /** The requestor ID which is unique in the system for all ports
      * that are capable of issuing a transaction
@@ -577,7 +578,7 @@ class Request
     {
         _flags.set(flags);
         privateFlags.set(VALID_PADDR|VALID_SIZE);
-        _byteEnable = std::vector<bool>(size, true);
+        _byteEnable = ByteEnable(size, true);
     }
 
     Request(Addr vaddr, unsigned size, Flags flags,
@@ -586,7 +587,7 @@ class Request
     {
         setVirt(vaddr, size, flags, id, pc, std::move(atomic_op));
         setContext(cid);
-        _byteEnable = std::vector<bool>(size, true);
+        _byteEnable = ByteEnable(size, true);
     }
 
     Request(const Request& other)
@@ -725,12 +726,8 @@ class Request
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
-        req1->_byteEnable = std::vector<bool>(
-            _byteEnable.begin(),
-            _byteEnable.begin() + req1->_size);
-        req2->_byteEnable = std::vector<bool>(
-            _byteEnable.begin() + req1->_size,
-            _byteEnable.end());
+        req1->_byteEnable = _byteEnable.slice(0, req1->_size);
+        req2->_byteEnable = _byteEnable.slice(req1->_size, req2->_size);
     }
 
     /**
@@ -808,14 +805,14 @@ class Request
         _size = size;
     }
 
-    const std::vector<bool>&
+    const ByteEnable&
     getByteEnable() const
     {
         return _byteEnable;
     }
 
     void
-    setByteEnable(const std::vector<bool>& be)
+    setByteEnable(const ByteEnable& be)
     {
         assert(be.size() == _size);
         _byteEnable = be;
@@ -829,10 +826,7 @@ class Request
     bool
     isMasked() const
     {
-        return std::find(
-            _byteEnable.begin(),
-            _byteEnable.end(),
-            false) != _byteEnable.end();
+        return !_byteEnable.all();
     }
 
     /** Accessor for time. */
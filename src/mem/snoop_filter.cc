@@ -42,6 +42,7 @@
 
 #include "mem/snoop_filter.hh"
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
@@ -52,17 +53,105 @@ namespace gem5
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
+SnoopFilter::Directory::Directory(unsigned entries, unsigned _assoc,
+                                 unsigned linesize)
+    : assoc(_assoc), lineShift(floorLog2(linesize)),
+      setMask(std::max(entries / _assoc, 1U) - 1),
+      waysPerBlock(setsPerBlock * _assoc),
+      blocks(divCeil(setMask + 1, setsPerBlock))
+{
+    fatal_if(assoc == 0, "Snoop filter associativity must be non-zero\n");
+    fatal_if(!isPowerOf2(setMask + 1),
+             "Snoop filter with %d entries and %d ways has %d sets, which "
+             "is not a power of 2\n", entries, assoc, entries / assoc);
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::Directory::find(Addr line_addr)
+{
+    size_t way = firstWay(line_addr);
+    Block &block = blocks[way / waysPerBlock];
+    if (!block.tags.empty()) {
+        way %= waysPerBlock;
+        for (size_t end = way + assoc; way < end; way++) {
+            if (block.tags[way] == line_addr)
+                return &block.items[way];
+        }
+    }
+    if (overflow.empty())
+        return nullptr;
+    auto it = overflow.find(line_addr);
+    return it == overflow.end() ? nullptr : &it->second;
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::Directory::insert(Addr line_addr, bool &overflowed)
+{
+    assert(line_addr != InvalidLine);
+    count++;
+
+    size_t way = firstWay(line_addr);
+    Block &block = blocks[way / waysPerBlock];
+    if (block.tags.empty()) {
+        block.tags.assign(waysPerBlock, InvalidLine);
+        block.items.resize(waysPerBlock);
+    }
+    way %= waysPerBlock;
+    for (size_t end = way + assoc; way < end; way++) {
+        if (block.tags[way] == InvalidLine) {
+            block.tags[way] = line_addr;
+            block.items[way] = SnoopItem();
+            overflowed = false;
+            return &block.items[way];
+        }
+    }
+
+    overflowed = true;
+    return &overflow.emplace(line_addr, SnoopItem()).first->second;
+}
+
 void
-SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
+SnoopFilter::Directory::erase(Addr line_addr, SnoopItem *item)
 {
-    SnoopItem& sf_item = sf_it->second;
-    if ((sf_item.requested | sf_item.holder).none()) {
-        cachedLocations.erase(sf_it);
+    assert(count > 0);
+    count--;
+
+    size_t way = firstWay(line_addr);
+    Block &block = blocks[way / waysPerBlock];
+    way %= waysPerBlock;
+    if (!block.items.empty() && item >= &block.items[way] &&
+        item < &block.items[way] + assoc) {
+        assert(block.tags[item - &block.items[0]] == line_addr);
+        block.tags[item - &block.items[0]] = InvalidLine;
+    } else {
+        [[maybe_unused]] size_t erased = overflow.erase(line_addr);
+        assert(erased == 1);
+    }
+}
+
+void
+SnoopFilter::eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item)
+{
+    if ((sf_item->requested | sf_item->holder).none()) {
+        cachedLocations.erase(line_addr, sf_item);
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
 }
 
+SnoopFilter::SnoopItem *
+SnoopFilter::insertLine(Addr line_addr)
+{
+    bool overflowed;
+    SnoopItem *sf_item = cachedLocations.insert(line_addr, overflowed);
+    if (overflowed) {
+        stats.setOverflows++;
+        DPRINTF(SnoopFilter, "%s:   set of %#x full, SF entry overflows\n",
+                __func__, line_addr);
+    }
+    return sf_item;
+}
+
 std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                            cpu_side_port)
@@ -78,8 +167,9 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         line_addr |= LineSecure;
     }
     SnoopMask req_port = portToMask(cpu_side_port);
-    reqLookupResult.it = cachedLocations.find(line_addr);
-    bool is_hit = (reqLookupResult.it != cachedLocations.end());
+    reqLookupResult.item = cachedLocations.find(line_addr);
+    reqLookupResult.lineAddr = line_addr;
+    bool is_hit = reqLookupResult.item != nullptr;
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
@@ -89,10 +179,9 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     // If no hit in snoop filter create a new element and update iterator
     if (!is_hit) {
-        reqLookupResult.it =
-            cachedLocations.emplace(line_addr, SnoopItem()).first;
+        reqLookupResult.item = insertLine(line_addr);
     }
-    SnoopItem& sf_item = reqLookupResult.it->second;
+    SnoopItem& sf_item = *reqLookupResult.item;
     SnoopMask interested = sf_item.holder | sf_item.requested;
 
     // Store unmodified value of snoop filter item in temp storage in
@@ -159,26 +248,27 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 void
 SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
 {
-    if (reqLookupResult.it != cachedLocations.end()) {
+    if (reqLookupResult.item) {
         // since we rely on the caller, do a basic check to ensure
         // that finishRequest is being called following lookupRequest
         Addr line_addr = (addr & ~(Addr(linesize - 1)));
         if (is_secure) {
             line_addr |= LineSecure;
         }
-        assert(reqLookupResult.it->first == line_addr);
+        assert(reqLookupResult.lineAddr == line_addr);
         if (will_retry) {
             SnoopItem retry_item = reqLookupResult.retryItem;
             // Undo any changes made in lookupRequest to the snoop filter
             // entry if the request will come again. retryItem holds
             // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
+            *reqLookupResult.item = retry_item;
 
             DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
                     __func__,  retry_item.requested, retry_item.holder);
         }
 
-        eraseIfNullEntry(reqLookupResult.it);
+        eraseIfNullEntry(line_addr, reqLookupResult.item);
+        reqLookupResult.item = nullptr;
     }
 }
 
@@ -193,8 +283,8 @@ SnoopFilter::lookupSnoop(Packet* cpkt)
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = (sf_it != cachedLocations.end());
+    SnoopItem *sf_entry = cachedLocations.find(line_addr);
+    bool is_hit = sf_entry != nullptr;
 
     panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
              "snoop filter exceeded capacity of %d cache blocks\n",
@@ -217,7 +307,7 @@ SnoopFilter::lookupSnoop(Packet* cpkt)
         return snoopDown(lookupLatency);
     }
 
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = *sf_entry;
 
     SnoopMask interested = (sf_item.holder | sf_item.requested);
 
@@ -247,7 +337,7 @@ SnoopFilter::lookupSnoop(Packet* cpkt)
         sf_item.holder = 0;
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_entry);
     }
 
     return snoopSelected(maskToPortList(interested), lookupLatency);
@@ -277,7 +367,10 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem& sf_item = cachedLocations[line_addr];
+    SnoopItem *sf_entry = cachedLocations.find(line_addr);
+    if (!sf_entry)
+        sf_entry = insertLine(line_addr);
+    SnoopItem& sf_item = *sf_entry;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -324,8 +417,8 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = sf_it != cachedLocations.end();
+    SnoopItem *sf_entry = cachedLocations.find(line_addr);
+    bool is_hit = sf_entry != nullptr;
 
     // Nothing to do if it is not a hit
     if (!is_hit)
@@ -335,7 +428,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     // Modified state, and we know that there are no other copies, or
     // they will all be invalidated imminently
     if (!cpkt->hasSharers()) {
-        SnoopItem& sf_item = sf_it->second;
+        SnoopItem& sf_item = *sf_entry;
 
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
@@ -343,7 +436,7 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
 
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_entry);
     }
 }
 
@@ -366,12 +459,12 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    if (sf_it == cachedLocations.end())
+    SnoopItem *sf_entry = cachedLocations.find(line_addr);
+    if (!sf_entry)
         return;
 
     SnoopMask response_mask = portToMask(cpu_side_port);
-    SnoopItem& sf_item = sf_it->second;
+    SnoopItem& sf_item = *sf_entry;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -390,7 +483,7 @@ SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
         if (cpkt->isInvalidate()) {
             sf_item.holder &= ~response_mask;
         }
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_entry);
     } else {
         // Any other response implies that a cache above will have the
         // block.
@@ -418,7 +511,10 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(setOverflows, statistics::units::Count::get(),
+               "Number of lines tracked while their set was full, each of "
+               "which would need a back-invalidation.")
 {}
 
 void
@@ -46,6 +46,7 @@
 #include <bitset>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mem/packet.hh"
 #include "mem/port.hh"
@@ -69,6 +70,9 @@ namespace gem5
  * allows the snoop filter to model cache-line residency by snooping
  * the messages.
  *
+ * The lines are tracked in a set-associative directory of max_capacity
+ * lines and assoc ways, see Directory.
+ *
  * The tracking happens in two fields to be able to distinguish
  * between in-flight requests (in requested) and already pulled in
  * lines (in holder). This distinction is used for producing tighter
@@ -96,9 +100,10 @@ class SnoopFilter : public SimObject
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
     SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
+        SimObject(p),
         linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
         maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
+        cachedLocations(maxEntryCount, p.assoc, p.system->cacheLineSize()),
         stats(this)
     {
     }
@@ -220,10 +225,66 @@ class SnoopFilter : public SimObject
         SnoopMask requested;
         SnoopMask holder;
     };
+
     /**
-     * HashMap of SnoopItems indexed by line address
+     * SnoopItems indexed by line address, kept in a set-associative
+     * array of assoc ways per set. The sets are allocated on first use,
+     * so a large filter costs nothing until lines map to it.
+     *
+     * Nothing is ever evicted, as that would need back-invalidating the
+     * caches above. A line whose set is full goes to an overflow map
+     * instead, and the filter counts it as the point where a directory
+     * of this size would have to back-invalidate.
      */
-    typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
+    class Directory
+    {
+      public:
+        Directory(unsigned entries, unsigned assoc, unsigned linesize);
+
+        /** The item of a line, or nullptr if it is not tracked. */
+        SnoopItem *find(Addr line_addr);
+
+        /**
+         * Start tracking a line that is not tracked yet.
+         *
+         * @param overflowed Set if the line did not fit its set.
+         */
+        SnoopItem *insert(Addr line_addr, bool &overflowed);
+
+        /** Stop tracking a line, item being its item. */
+        void erase(Addr line_addr, SnoopItem *item);
+
+        size_t size() const { return count; }
+
+      private:
+        /** Tag of a free way, never a line address */
+        static constexpr Addr InvalidLine = MaxAddr;
+
+        /** Sets allocated together */
+        static constexpr unsigned setsPerBlock = 64;
+
+        struct Block
+        {
+            std::vector<Addr> tags;
+            std::vector<SnoopItem> items;
+        };
+
+        /** Index of the first way of the set of a line. */
+        size_t
+        firstWay(Addr line_addr) const
+        {
+            return ((line_addr >> lineShift) & setMask) * assoc;
+        }
+
+        const unsigned assoc;
+        const unsigned lineShift;
+        const Addr setMask;
+        const size_t waysPerBlock;
+
+        std::vector<Block> blocks;
+        std::unordered_map<Addr, SnoopItem> overflow;
+        size_t count = 0;
+    };
 
     /**
      * Simple factory methods for standard return values.
@@ -261,10 +322,10 @@ class SnoopFilter : public SimObject
     /**
      * Removes snoop filter items which have no requestors and no holders.
      */
-    void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
+    void eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item);
 
-    /** Simple hash set of cached addresses. */
-    SnoopFilterCache cachedLocations;
+    /** Start tracking a line that is not tracked yet. */
+    SnoopItem *insertLine(Addr line_addr);
 
     /**
      * A request lookup must be followed by a call to finishRequest to inform
@@ -274,27 +335,18 @@ class SnoopFilter : public SimObject
      */
     struct ReqLookupResult
     {
-        /** Iterator used to store the result from lookupRequest. */
-        SnoopFilterCache::iterator it;
+        /** Item found or made by lookupRequest, nullptr if none. */
+        SnoopItem *item = nullptr;
+
+        /** Line address of item */
+        Addr lineAddr = 0;
 
         /**
          * Variable to temporarily store value of snoopfilter entry
          * in case finishRequest needs to undo changes made in lookupRequest
          * (because of crossbar retry)
          */
-        SnoopItem retryItem;
-
-        /**
-         * The constructor must be informed of the internal cache's end
-         * iterator, so do not allow the compiler to implictly define it.
-         *
-         * @param end_it Iterator to the end of the internal cache.
-         */
-        ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0}
-        {
-        }
-        ReqLookupResult() = delete;
+        SnoopItem retryItem{0, 0};
     } reqLookupResult;
 
     /** List of all attached snooping CPU-side ports. */
@@ -308,6 +360,9 @@ class SnoopFilter : public SimObject
     /** Max capacity in terms of cache blocks tracked, for sanity checking */
     const unsigned maxEntryCount;
 
+    /** The tracked cache lines. */
+    Directory cachedLocations;
+
     /**
      * Use the lower bits of the address to keep track of the line status
      */
@@ -329,6 +384,8 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar setOverflows;
     } stats;
 };
 
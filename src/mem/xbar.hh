@@ -50,6 +50,7 @@
 #include <unordered_map>
 
 #include "base/addr_range_map.hh"
+#include "base/cast.hh"
 #include "base/types.hh"
 #include "mem/qport.hh"
 #include "params/BaseXBar.hh"
@@ -318,11 +319,38 @@ class BaseXBar : public ClockedObject
 
     AddrRangeMap<PortID, 3> portMap;
 
+    /**
+     * Where to route the response to a request forwarded through a
+     * memory-side port. It travels on the request's sender-state stack
+     * and comes back on the response, so the common path needs no table.
+     */
+    struct RouteState : public Packet::SenderState
+    {
+        const PortID port;
+        RouteState(PortID _port) : port(_port) {}
+    };
+
+    void
+    pushRoute(PacketPtr pkt, PortID cpu_side_port_id)
+    {
+        pkt->pushSenderState(new RouteState(cpu_side_port_id));
+    }
+
+    /** The port the response pkt is routed to, left on the packet. */
+    PortID
+    peekRoute(PacketPtr pkt) const
+    {
+        return safe_cast<RouteState *>(pkt->senderState)->port;
+    }
+
+    void popRoute(PacketPtr pkt) { delete pkt->popSenderState(); }
+
     /**
      * Remember where request packets came from so that we can route
-     * responses to the appropriate port. This relies on the fact that
-     * the underlying Request pointer inside the Packet stays
-     * constant.
+     * responses to the appropriate port, for the responses that do not
+     * carry a RouteState: snoop responses, and responses the crossbar
+     * sends itself. This relies on the fact that the underlying Request
+     * pointer inside the Packet stays constant.
      */
     std::unordered_map<RequestPtr, PortID> routeTo;
 
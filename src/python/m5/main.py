@@ -115,6 +115,14 @@ def parse_options():
     option("--stats-help",
            action="callback", callback=_stats_help,
            help="Display documentation for available stat visitors")
+    option("--host-profile", metavar="FILE", default=None,
+        help="Charge the host time of every event to its SimObject and "
+        "write a table of it to FILE at every stats dump")
+    option("--event-scheduler", metavar="{list,calendar}",
+        choices=["list", "calendar"], default="list",
+        help="How the event queues order their events, a sorted list or "
+        "a calendar of the near future, faster with many events pending "
+        "[Default: %default]")
 
     # Configuration Options
     group("Configuration Options")
@@ -212,6 +220,9 @@ def main():
 
     m5.options = options
 
+    if options.event_scheduler == "calendar":
+        event.setEventScheduler(event.EventScheduler.Calendar)
+
     # Set the main event queue for the main thread.
     event.mainq = event.getEventQueue(0)
     event.setEventQueue(event.mainq)
@@ -342,6 +353,8 @@ def main():
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    if options.host_profile:
+        event.enableHostProfile(options.host_profile)
 
     # Disable listeners unless running interactively or explicitly
     # enabled
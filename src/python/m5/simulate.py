@@ -242,6 +242,23 @@ def checkpoint(dir):
     print("Writing checkpoint")
     _m5.core.serializeAll(dir)
 
+def saveWarmState(path):
+    """Write the warmed caches, prefetcher and branch predictor tables
+    to a warm state snapshot. The simulator is drained first so that no access is in
+    flight."""
+    drain()
+    print("Writing warm state to %s" % path)
+    _m5.core.saveWarmState(path)
+
+def loadWarmState(path):
+    """Restore a snapshot written by saveWarmState. Call it between
+    m5.instantiate() and the first m5.simulate(), so that the accesses
+    replayed into the caches are cleared by the initial stats reset."""
+    if not _instantiated or not need_startup:
+        fatal("m5.loadWarmState() must be called after m5.instantiate() "
+              "and before m5.simulate().")
+    _m5.core.loadWarmState(path)
+
 def _changeMemoryMode(system, mode):
     if not isinstance(system, (objects.Root, objects.System)):
         raise TypeError("Parameter of type '%s'.  Must be type %s or %s." % \
@@ -194,6 +194,22 @@ def _jsonFactory(fn):
 
     return JsonOutputVistor(fn)
 
+@_url_factory(["bin"])
+def _binaryFactory(fn):
+    """Output stats in a compact binary format.
+
+    Every dump only stores the stats that changed since the previous
+    one, which keeps frequent periodic dumps small and fast. Use
+    util/binary_stats.py to read the file back as a table with one row
+    per dump.
+
+    Example:
+      bin://stats.bin
+
+    """
+
+    return _m5.stats.initBinary(fn)
+
 def addStatVisitor(url):
     """Add a stat visitor specified using a URL string
 
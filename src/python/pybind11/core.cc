@@ -58,6 +58,7 @@
 #include "sim/drain.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_object.hh"
+#include "sim/warm_state.hh"
 
 namespace py = pybind11;
 
@@ -298,6 +299,8 @@ pybind_init_core(py::module_ &m_native)
             SimObject::setSimObjectResolver(&pybindSimObjectResolver);
             return new CheckpointIn(cpt_dir);
         })
+        .def("saveWarmState", &WarmStateful::saveAll)
+        .def("loadWarmState", &WarmStateful::loadAll)
 
         ;
 
@@ -45,6 +45,7 @@
 
 #include "base/logging.hh"
 #include "sim/eventq.hh"
+#include "sim/host_profile.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
 #include "sim/simulate.hh"
@@ -114,6 +115,13 @@ pybind_init_event(py::module_ &m_native)
     m.def("setEventQueue", [](EventQueue *q) { return curEventQueue(q); });
     m.def("getEventQueue", &getEventQueue,
           py::return_value_policy::reference);
+    m.def("enableHostProfile", &enableHostProfile);
+
+    py::enum_<EventScheduler>(m, "EventScheduler")
+        .value("List", EventScheduler::List)
+        .value("Calendar", EventScheduler::Calendar)
+        ;
+    m.def("setEventScheduler", &setEventScheduler);
 
     py::class_<EventQueue>(m, "EventQueue")
         .def("name",  [](EventQueue *eq) { return eq->name(); })
@@ -90,6 +90,11 @@ class System(SimObject):
     auto_unlink_shared_backstore = Param.Bool(False, "Automatically remove the "
         "shmem segment file upon destruction. This is used only if "
         "shared_backstore is non-empty.")
+    shared_backstore_cow = Param.Bool(False, "Map an existing "
+        "shared_backstore copy-on-write instead of MAP_SHARED. The segment "
+        "must already hold the restored checkpoint, e.g. written by another "
+        "run using shared_backstore alone, and is left unchanged, so several "
+        "processes can start from it at once.")
 
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
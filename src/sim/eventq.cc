@@ -37,10 +37,12 @@
 #include <unordered_map>
 #include <vector>
 
+#include "base/bitfield.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/host_profile.hh"
 
 namespace gem5
 {
@@ -57,6 +59,8 @@ uint32_t numMainEventQueues = 0;
 std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
+EventScheduler eventScheduler = EventScheduler::List;
+HostProfile *hostProfile = nullptr;
 
 EventQueue *
 getEventQueue(uint32_t index)
@@ -70,6 +74,14 @@ getEventQueue(uint32_t index)
     return mainEventQueue[index];
 }
 
+void
+setEventScheduler(EventScheduler scheduler)
+{
+    eventScheduler = scheduler;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->setScheduler(scheduler);
+}
+
 #ifndef NDEBUG
 Counter Event::instanceCounter = 0;
 #endif
@@ -78,6 +90,8 @@ Event::~Event()
 {
     assert(!scheduled());
     flags = 0;
+    if (hostProfile)
+        hostProfile->forget(this);
 }
 
 const std::string
@@ -111,6 +125,11 @@ Event::insertBefore(Event *event, Event *curr)
 void
 EventQueue::insert(Event *event)
 {
+    if (calendar) {
+        insertCalendar(event);
+        return;
+    }
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -170,6 +189,11 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
+    if (calendar) {
+        removeCalendar(event);
+        return;
+    }
+
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
@@ -194,6 +218,143 @@ EventQueue::remove(Event *event)
     prev->nextBin = Event::removeItem(event, curr);
 }
 
+EventQueue::Calendar::Calendar(Tick now)
+    : slots(numSlots), occupied(numSlots / 64),
+      start(now & ~((Tick(1) << slotShift) - 1))
+{
+}
+
+void
+EventQueue::Calendar::place(Event *top)
+{
+    if (top->when() >= end()) {
+        top->nextBin = NULL;
+        later[{top->when(), top->priority()}] = top;
+        return;
+    }
+
+    const size_t i = slot(top->when());
+    Event **link = &slots[i];
+    while (*link && **link < *top)
+        link = &(*link)->nextBin;
+    top->nextBin = *link;
+    *link = top;
+    occupied[i / 64] |= 1ULL << (i % 64);
+}
+
+std::vector<Event *>
+EventQueue::Calendar::bins() const
+{
+    std::vector<Event *> tops;
+    for (size_t off = 0; off < numSlots; ++off) {
+        for (Event *top = slots[slot(start + (Tick(off) << slotShift))];
+             top; top = top->nextBin) {
+            tops.push_back(top);
+        }
+    }
+    for (const auto &bin : later)
+        tops.push_back(bin.second);
+    return tops;
+}
+
+Event *
+EventQueue::Calendar::first(Tick from) const
+{
+    // Look for an occupied slot a word of the bitmap at a time, from the
+    // one of from to the end of the window
+    const size_t base = slot(start);
+    size_t off = from < start ? 0 : (from - start) >> slotShift;
+    while (off < numSlots) {
+        const size_t i = (base + off) & (numSlots - 1);
+        const uint64_t bits = occupied[i / 64] >> (i % 64);
+        if (bits) {
+            off += ctz64(bits);
+            if (off < numSlots)
+                return slots[(base + off) & (numSlots - 1)];
+            break;
+        }
+        off += 64 - i % 64;
+    }
+
+    return later.empty() ? NULL : later.begin()->second;
+}
+
+void
+EventQueue::Calendar::advance(Tick now)
+{
+    const Tick now_start = now & ~((Tick(1) << slotShift) - 1);
+    if (now_start <= start)
+        return;
+
+    // Nothing is due before now, so the slots the window leaves are
+    // empty and can be reused for the ones it reaches
+    start = now_start;
+    const Tick window_end = end();
+    while (!later.empty() && later.begin()->first.first < window_end) {
+        Event *top = later.begin()->second;
+        later.erase(later.begin());
+        place(top);
+    }
+}
+
+void
+EventQueue::insertCalendar(Event *event)
+{
+    Calendar &cal = *calendar;
+
+    if (event->when() < cal.start) {
+        // The current tick was moved back, move the window back with it
+        std::vector<Event *> tops = cal.bins();
+        cal = Calendar(event->when());
+        for (Event *top : tops)
+            cal.place(top);
+    }
+
+    if (event->when() < cal.end()) {
+        const size_t i = cal.slot(event->when());
+        Event **link = &cal.slots[i];
+        while (*link && **link < *event)
+            link = &(*link)->nextBin;
+        *link = Event::insertBefore(event, *link);
+        cal.occupied[i / 64] |= 1ULL << (i % 64);
+    } else {
+        Event *&top = cal.later[{event->when(), event->priority()}];
+        top = Event::insertBefore(event, top);
+    }
+
+    if (!head || *event <= *head)
+        head = event;
+}
+
+void
+EventQueue::removeCalendar(Event *event)
+{
+    Calendar &cal = *calendar;
+
+    if (event->when() < cal.end()) {
+        const size_t i = cal.slot(event->when());
+        Event **link = &cal.slots[i];
+        while (*link && **link < *event)
+            link = &(*link)->nextBin;
+        if (!*link || **link != *event)
+            panic("event not found!");
+        *link = Event::removeItem(event, *link);
+        if (!cal.slots[i])
+            cal.occupied[i / 64] &= ~(1ULL << (i % 64));
+    } else {
+        auto bin = cal.later.find({event->when(), event->priority()});
+        if (bin == cal.later.end())
+            panic("event not found!");
+        if (Event *top = Event::removeItem(event, bin->second))
+            bin->second = top;
+        else
+            cal.later.erase(bin);
+    }
+
+    if (event == head)
+        head = event->nextInBin ? event->nextInBin : cal.first(event->when());
+}
+
 Event *
 EventQueue::serviceOne()
 {
@@ -202,7 +363,9 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
-    if (next) {
+    if (calendar) {
+        removeCalendar(event);
+    } else if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
 
@@ -218,9 +381,14 @@ EventQueue::serviceOne()
     if (!event->squashed()) {
         // forward current cycle to the time when this event occurs.
         setCurTick(event->when());
+        if (calendar)
+            calendar->advance(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (hostProfile)
+            hostProfile->process(event);
+        else
+            event->process();
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -295,15 +463,12 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
+        for (Event *nextBin : bins()) {
             Event *nextInBin = nextBin;
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -318,8 +483,7 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
+    for (Event *nextBin : bins()) {
         Event *nextInBin = nextBin;
         while (nextInBin) {
             if (nextInBin->when() < time) {
@@ -345,21 +509,58 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
 }
 
+std::vector<Event *>
+EventQueue::bins() const
+{
+    if (calendar)
+        return calendar->bins();
+
+    std::vector<Event *> tops;
+    for (Event *top = head; top; top = top->nextBin)
+        tops.push_back(top);
+    return tops;
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
+    if (calendar) {
+        // The calendar can't take a list of bins, so swap it for an
+        // empty one instead and back
+        if (!s) {
+            panic_if(parkedCalendar, "%s: head replaced twice.\n", name());
+            parkedCalendar = std::move(calendar);
+            calendar = std::make_unique<Calendar>(0);
+        } else {
+            panic_if(!parkedCalendar || head ||
+                     s != parkedCalendar->first(0),
+                     "%s: only the replaced head can be put back.\n",
+                     name());
+            calendar = std::move(parkedCalendar);
+        }
+    }
     head = s;
     return t;
 }
 
+void
+EventQueue::setScheduler(EventScheduler scheduler)
+{
+    panic_if(!empty(), "%s: can't switch schedulers with events pending.\n",
+             name());
+
+    if (scheduler == EventScheduler::Calendar)
+        calendar = std::make_unique<Calendar>(getCurTick());
+    else
+        calendar.reset();
+}
+
 void
 dumpMainQueue()
 {
@@ -418,6 +619,7 @@ Event::dump() const
 EventQueue::EventQueue(const std::string &n)
     : objName(n), head(NULL), _curTick(0)
 {
+    setScheduler(eventScheduler);
 }
 
 void
@@ -41,8 +41,11 @@
 #include <functional>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -85,6 +88,17 @@ extern bool inParallelMode;
 //! is with in bounds.
 EventQueue *getEventQueue(uint32_t index);
 
+//! How event queues keep their events in order, see EventQueue.
+enum class EventScheduler
+{
+    List,
+    Calendar
+};
+
+//! Use the given scheduler for the main event queues, which must have
+//! no events scheduled yet, and the ones allocated later.
+void setEventScheduler(EventScheduler scheduler);
+
 inline EventQueue *curEventQueue() { return _curEventQueue; }
 inline void curEventQueue(EventQueue *q);
 
@@ -618,16 +632,74 @@ operator!=(const Event &l, const Event &r)
  * events must happen at least one simulation quantum into the future,
  * otherwise they risk being scheduled in the past by
  * handleAsyncInsertions().
+ *
+ * Events due at the same tick with the same priority form a bin, a
+ * stack serviced last in first out. The list scheduler keeps the bins
+ * in a sorted list, so scheduling an event walks all the bins due
+ * before it. The calendar scheduler splits the near future into slots
+ * of a fixed number of ticks, each a sorted list of the few bins due
+ * in it, and keeps the later bins in an ordered map, so scheduling
+ * costs about the same however many events are pending. Both service
+ * the events in the same order.
  */
 class EventQueue
 {
   private:
     friend void curEventQueue(EventQueue *);
 
+    /**
+     * The bins of the calendar scheduler. The window of the calendar
+     * starts at the slot of the current tick, or earlier, and the bins
+     * due in the window are in the slot lists, the later ones in the
+     * map. The window moves forward with the current tick, taking the
+     * bins it reaches from the map.
+     */
+    struct Calendar
+    {
+        /** Slots of 256 ticks, a window of about a million ticks. */
+        static constexpr int slotShift = 8;
+        static constexpr size_t numSlots = 4096;
+
+        /** Sorted lists of bins, linked through their nextBin. */
+        std::vector<Event *> slots;
+        /** A bit per slot, set if its list is not empty. */
+        std::vector<uint64_t> occupied;
+        /** Tops of the bins due at or after the end of the window. */
+        std::map<std::pair<Tick, Event::Priority>, Event *> later;
+        /** The start of the window, a multiple of the slot size. */
+        Tick start;
+
+        Calendar(Tick now);
+
+        Tick end() const { return start + (Tick(numSlots) << slotShift); }
+        size_t
+        slot(Tick when) const
+        {
+            return (when >> slotShift) & (numSlots - 1);
+        }
+
+        /** Insert a bin, due at or after the start of the window. */
+        void place(Event *top);
+
+        /** Return the tops of the bins in order. */
+        std::vector<Event *> bins() const;
+
+        /** The top of the first bin due at or after tick from. */
+        Event *first(Tick from) const;
+
+        /** Move the window to the slot of now. */
+        void advance(Tick now);
+    };
+
     std::string objName;
     Event *head;
     Tick _curTick;
 
+    /** The bins of the calendar scheduler, null with the list one. */
+    std::unique_ptr<Calendar> calendar;
+    /** The calendar put aside by replaceHead(). */
+    std::unique_ptr<Calendar> parkedCalendar;
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
@@ -660,6 +732,11 @@ class EventQueue
     //! by thread operating this queue.
     void insert(Event *event);
     void remove(Event *event);
+    void insertCalendar(Event *event);
+    void removeCalendar(Event *event);
+
+    /** Return the tops of the bins in order. */
+    std::vector<Event *> bins() const;
 
     //! Function for adding events to the async queue. The added events
     //! are added to main event queue later. Threads, other than the
@@ -857,6 +934,9 @@ class EventQueue
     Tick getCurTick() const { return _curTick; }
     Event *getHead() const { return head; }
 
+    /** Switch to another scheduler, the queue must be empty. */
+    void setScheduler(EventScheduler scheduler);
+
     Event *serviceOne();
 
     /**
@@ -0,0 +1,236 @@
+/**
+ * @file
+ * Service order of the event queue schedulers. The calendar scheduler
+ * must service events exactly in the order of the list scheduler.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class RecordEvent : public Event
+{
+  public:
+    RecordEvent(std::vector<int> &_log, int _id, Priority prio=Default_Pri)
+        : Event(prio), log(_log), id(_id)
+    {}
+
+    void process() override { log.push_back(id); }
+
+  private:
+    std::vector<int> &log;
+    const int id;
+};
+
+/** Ticks covered by the window of the calendar scheduler. */
+const Tick calendarWindow = Tick(4096) << 8;
+
+class EventQueueTest : public testing::TestWithParam<EventScheduler>
+{
+  protected:
+    EventQueueTest() : queue("test")
+    {
+        queue.setScheduler(GetParam());
+    }
+
+    ~EventQueueTest()
+    {
+        while (!queue.empty())
+            queue.deschedule(queue.getHead());
+    }
+
+    RecordEvent *
+    event(int id, Event::Priority prio=Event::Default_Pri)
+    {
+        events.push_back(std::make_unique<RecordEvent>(log, id, prio));
+        return events.back().get();
+    }
+
+    void
+    serviceAll()
+    {
+        while (!queue.empty()) {
+            EXPECT_TRUE(queue.debugVerify());
+            queue.serviceOne();
+        }
+    }
+
+    EventQueue queue;
+    std::vector<int> log;
+    std::vector<std::unique_ptr<RecordEvent>> events;
+};
+
+} // anonymous namespace
+
+/** Events of the same tick and priority are serviced last in, first out. */
+TEST_P(EventQueueTest, LifoWithinBin)
+{
+    queue.schedule(event(0), 1000);
+    queue.schedule(event(1), 1000);
+    queue.schedule(event(2, Event::Default_Pri - 1), 1000);
+    queue.schedule(event(3), 1000);
+    queue.schedule(event(4, Event::Default_Pri + 1), 1000);
+    queue.schedule(event(5), 999);
+    queue.schedule(event(6, Event::Default_Pri - 1), 1000);
+
+    // take one out of the middle of a bin and put it back on top
+    queue.reschedule(events[1].get(), 1000);
+    // and one on top of the head
+    queue.schedule(event(7), 999);
+
+    serviceAll();
+    EXPECT_EQ(log, std::vector<int>({7, 5, 6, 2, 1, 3, 0, 4}));
+    EXPECT_EQ(queue.getCurTick(), 1000);
+}
+
+/**
+ * Events keep their order when the window of the calendar wraps around
+ * its slots.
+ */
+TEST_P(EventQueueTest, WindowWrapAround)
+{
+    const Tick start = calendarWindow - 300;
+    queue.schedule(event(0), start);
+    serviceAll();
+
+    // the slots before the one of start hold the ticks past the window
+    queue.schedule(event(1), calendarWindow + 10);
+    queue.schedule(event(2), start + 1);
+    queue.schedule(event(3), calendarWindow - 1);
+    queue.schedule(event(4), start + calendarWindow - 1);
+    queue.schedule(event(5), calendarWindow);
+    queue.schedule(event(6), calendarWindow + 10);
+    queue.schedule(event(7), start + 256);
+
+    serviceAll();
+    EXPECT_EQ(log, std::vector<int>({0, 2, 7, 3, 5, 6, 1, 4}));
+}
+
+/**
+ * Bins due after the window keep their order when the window reaches
+ * them, and can be descheduled before and after.
+ */
+TEST_P(EventQueueTest, LaterBinsMoveIntoWindow)
+{
+    const Tick far = 10 * calendarWindow;
+    queue.schedule(event(0), far);
+    queue.schedule(event(1), far);
+    queue.schedule(event(2, Event::Default_Pri + 1), far);
+    queue.schedule(event(3), far - 1000);
+    queue.schedule(event(4), far);
+    queue.schedule(event(5), far + 1);
+    queue.schedule(event(6), 100);
+    queue.schedule(event(7), far);
+    queue.deschedule(events[4].get());
+
+    // servicing event 3 moves the window to the bins at far
+    queue.serviceOne();
+    queue.serviceOne();
+    EXPECT_EQ(log, std::vector<int>({6, 3}));
+
+    queue.deschedule(events[1].get());
+    queue.schedule(event(8), far);
+    queue.schedule(event(9), far - 1);
+
+    serviceAll();
+    EXPECT_EQ(log, std::vector<int>({6, 3, 9, 8, 7, 0, 2, 5}));
+}
+
+/** Events can run on a replaced head, and the old ones resume after. */
+TEST_P(EventQueueTest, ReplaceHead)
+{
+    queue.schedule(event(0), 5000);
+    queue.schedule(event(1), 3000);
+    queue.schedule(event(2), 3 * calendarWindow);
+    queue.serviceOne();
+    EXPECT_EQ(log, std::vector<int>({1}));
+
+    Event *head = queue.replaceHead(nullptr);
+    EXPECT_TRUE(queue.empty());
+
+    // like the Ruby cache warmup, from tick 0
+    queue.setCurTick(0);
+    queue.schedule(event(3), 10);
+    queue.schedule(event(4), 2 * calendarWindow);
+    queue.schedule(event(5), 10);
+    serviceAll();
+    EXPECT_EQ(log, std::vector<int>({1, 5, 3, 4}));
+
+    queue.replaceHead(head);
+    queue.setCurTick(3000);
+    EXPECT_EQ(queue.getHead(), events[0].get());
+    queue.schedule(event(6), 4000);
+    serviceAll();
+    EXPECT_EQ(log, std::vector<int>({1, 5, 3, 4, 6, 0, 2}));
+}
+
+/**
+ * Random schedules, deschedules and reschedules are serviced in the same
+ * order as with the list scheduler.
+ */
+TEST_P(EventQueueTest, MatchesListScheduler)
+{
+    auto run = [](EventScheduler scheduler, unsigned seed) {
+        EventQueue queue("random");
+        queue.setScheduler(scheduler);
+
+        std::vector<int> log;
+        std::vector<std::unique_ptr<RecordEvent>> events;
+        std::mt19937_64 rng(seed);
+        for (int i = 0; i < 200; i++) {
+            events.push_back(std::make_unique<RecordEvent>(log, i,
+                Event::Priority(int(rng() % 5) - 2)));
+        }
+
+        auto when = [&]() -> Tick {
+            const Tick now = queue.getCurTick();
+            switch (rng() % 4) {
+              case 0: return now + rng() % 4;
+              case 1: return now + rng() % 64 * 333;
+              case 2: return now + rng() % (2 * calendarWindow);
+              default: return now + rng() % (100 * calendarWindow);
+            }
+        };
+
+        for (int step = 0; step < 20000; step++) {
+            Event *event = events[rng() % events.size()].get();
+            const int op = rng() % 10;
+            if (op < 4) {
+                if (!event->scheduled())
+                    queue.schedule(event, when());
+            } else if (op < 5) {
+                if (event->scheduled())
+                    queue.deschedule(event);
+            } else if (op < 7) {
+                queue.reschedule(event, when(), true);
+            } else if (!queue.empty()) {
+                queue.serviceOne();
+            }
+        }
+        EXPECT_TRUE(queue.debugVerify());
+        while (!queue.empty())
+            queue.serviceOne();
+        return log;
+    };
+
+    for (unsigned seed = 1; seed <= 10; seed++) {
+        const std::vector<int> log = run(GetParam(), seed);
+        EXPECT_GT(log.size(), 5000);
+        EXPECT_EQ(log, run(EventScheduler::List, seed)) << "seed " << seed;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Schedulers, EventQueueTest,
+    testing::Values(EventScheduler::List, EventScheduler::Calendar),
+    [](const testing::TestParamInfo<EventScheduler> &info) {
+        return info.param == EventScheduler::List ? "List" : "Calendar";
+    });
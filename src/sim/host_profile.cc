@@ -0,0 +1,136 @@
+#include "sim/host_profile.hh"
+
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "cpu/base.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+HostProfile::HostProfile(const std::string &file_name)
+    : stream(simout.create(file_name)), startCycles(hostCycles()),
+      startTime(std::chrono::steady_clock::now()), startInsts(0)
+{
+    fatal_if(!stream, "Can't create host profile %s.\n", file_name);
+
+    statistics::registerDumpCallback([this]() { dump(); });
+    statistics::registerResetCallback([this]() { reset(); });
+}
+
+void
+HostProfile::process(Event *event)
+{
+    Account &acc = account(event);
+    uint64_t start = hostCycles();
+    event->process();
+    acc.cycles += hostCycles() - start;
+    acc.events++;
+}
+
+HostProfile::Account &
+HostProfile::account(const Event *event)
+{
+    Account **acc;
+    if (!event->isAutoDelete()) {
+        acc = &owners[event];
+    } else {
+        const std::type_index type(typeid(*event));
+        if (type == typeid(EventFunctionWrapper))
+            acc = &wrapperOwners[event->name()];
+        else
+            acc = &typeOwners[type];
+    }
+
+    if (!*acc)
+        *acc = &resolve(event);
+    return **acc;
+}
+
+HostProfile::Account &
+HostProfile::resolve(const Event *event)
+{
+    // the accounts are not locked
+    fatal_if(numMainEventQueues > 1,
+             "The host profile supports a single event queue only.\n");
+
+    const std::string name = event->name();
+    std::string owner = "-";
+    std::string what = event->description();
+    for (size_t dot = name.rfind('.'); dot != std::string::npos && dot > 0;
+         dot = name.rfind('.', dot - 1)) {
+        std::string prefix = name.substr(0, dot);
+        if (SimObject::find(prefix.c_str())) {
+            owner = prefix;
+            what = name.substr(dot + 1);
+            break;
+        }
+    }
+
+    return accounts[{owner, what}];
+}
+
+void
+HostProfile::dump()
+{
+    // calibrate the cycle counter against the host clock
+    const double ns_per_cycle =
+        std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - startTime).count() /
+        std::max<uint64_t>(hostCycles() - startCycles, 1);
+    const Counter insts = BaseCPU::numSimulatedInsts() - startInsts;
+    const double kinsts = std::max<double>(insts / 1000.0, 1e-3);
+
+    std::vector<std::pair<const std::pair<std::string, std::string> *,
+                          const Account *>> rows;
+    uint64_t total = 0;
+    for (const auto &[key, acc] : accounts) {
+        if (acc.events == 0)
+            continue;
+        rows.emplace_back(&key, &acc);
+        total += acc.cycles;
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) {
+        return a.second->cycles > b.second->cycles;
+    });
+
+    std::ostream &os = *stream->stream();
+    ccprintf(os, "\n---------- Begin Host Profile ----------\n");
+    ccprintf(os, "# sim_insts %d, host seconds in events %.3f\n", insts,
+             total * ns_per_cycle / 1e9);
+    ccprintf(os, "%-48s %-32s %12s %12s %14s %7s\n", "object", "event",
+             "events", "host_ms", "ns_per_kinst", "share");
+    for (const auto &[key, acc] : rows) {
+        const double ns = acc->cycles * ns_per_cycle;
+        ccprintf(os, "%-48s %-32s %12d %12.3f %14.1f %6.2f%%\n",
+                 key->first, key->second, acc->events, ns / 1e6,
+                 ns / kinsts, 100.0 * acc->cycles / total);
+    }
+    ccprintf(os, "---------- End Host Profile   ----------\n");
+    os.flush();
+}
+
+void
+HostProfile::reset()
+{
+    // keep the accounts, the cached owners point to them
+    for (auto &[key, acc] : accounts)
+        acc = Account();
+    startInsts = BaseCPU::numSimulatedInsts();
+}
+
+void
+enableHostProfile(const std::string &file_name)
+{
+    fatal_if(hostProfile, "The host profile is enabled already.\n");
+    hostProfile = new HostProfile(file_name);
+}
+
+} // namespace gem5
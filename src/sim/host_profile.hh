@@ -0,0 +1,112 @@
+/**
+ * @file
+ * Opt-in accounting of the host time spent processing events. Every
+ * event is timed with the host cycle counter and charged to the
+ * SimObject it belongs to, found as the longest dotted prefix of the
+ * event name naming a SimObject. Events of no SimObject are charged to
+ * "-" under their description, since most of them have a name per
+ * instance. Auto deleted events are charged to the owner of the first
+ * event of their type, or of their name for function wrappers. At every
+ * stats dump a table of the host time, the number of events and the
+ * host nanoseconds per thousand simulated instructions of each
+ * (object, event) pair since the last stats reset is appended to the
+ * profile file.
+ */
+
+#ifndef __SIM_HOST_PROFILE_HH__
+#define __SIM_HOST_PROFILE_HH__
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class Event;
+class OutputStream;
+
+class HostProfile
+{
+  public:
+    /** Append the tables to file_name in the output directory. */
+    HostProfile(const std::string &file_name);
+
+    virtual ~HostProfile() = default;
+
+    /**
+     * Process an event, charging the host time it took to its owner.
+     * Virtual so that the event queue does not link against the
+     * profiler.
+     */
+    virtual void process(Event *event);
+
+    /** Drop the cached owner of an event that goes away. */
+    void forget(const Event *event) { owners.erase(event); }
+
+  private:
+    /** Host time and events of one event of one SimObject. */
+    struct Account
+    {
+        uint64_t cycles = 0;
+        uint64_t events = 0;
+    };
+
+    static uint64_t
+    hostCycles()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    Account &account(const Event *event);
+
+    /** Find the owner of an event and its account. */
+    Account &resolve(const Event *event);
+
+    void dump();
+    void reset();
+
+    OutputStream *stream;
+
+    /** Accounts by owner and event name. */
+    std::map<std::pair<std::string, std::string>, Account> accounts;
+
+    /** Accounts of the events seen so far, except auto deleted ones. */
+    std::unordered_map<const Event *, Account *> owners;
+
+    /**
+     * Accounts of auto deleted events, which come and go, by type, or by
+     * name for the function wrappers that all share a type.
+     */
+    std::unordered_map<std::type_index, Account *> typeOwners;
+    std::unordered_map<std::string, Account *> wrapperOwners;
+
+    /** When the accounting started, in host cycles and time. */
+    uint64_t startCycles;
+    std::chrono::steady_clock::time_point startTime;
+    Counter startInsts;
+};
+
+/** The host profile, if one was asked for, defined in eventq.cc. */
+extern HostProfile *hostProfile;
+
+/** Account the host time of events from now on. */
+void enableHostProfile(const std::string &file_name);
+
+} // namespace gem5
+
+#endif // __SIM_HOST_PROFILE_HH__
@@ -46,6 +46,7 @@
 #include <mutex>
 #include <thread>
 
+#include "base/callback.hh"
 #include "base/logging.hh"
 #include "base/pollevent.hh"
 #include "base/types.hh"
@@ -167,6 +168,33 @@ class SimulatorThreads
 
 static std::unique_ptr<SimulatorThreads> simulatorThreads;
 
+static CallbackQueue &
+quantumCallbacks()
+{
+    static CallbackQueue callbacks;
+    return callbacks;
+}
+
+void
+registerQuantumCallback(const std::function<void()> &callback)
+{
+    quantumCallbacks().push_back(callback);
+}
+
+/** The barrier between quanta, which also runs the quantum callbacks. */
+class QuantumEvent : public GlobalSyncEvent
+{
+  public:
+    using GlobalSyncEvent::GlobalSyncEvent;
+
+    void
+    process() override
+    {
+        quantumCallbacks().process();
+        GlobalSyncEvent::process();
+    }
+};
+
 struct DescheduleDeleter
 {
     void operator()(BaseGlobalEvent *event)
@@ -203,16 +231,19 @@ simulate(Tick num_cycles)
     }
     simulate_limit_event->reschedule(exit_tick);
 
-    if (numMainEventQueues > 1) {
+    // a single queue with quantum callbacks stops at the same quanta as
+    // its parallel version would
+    if (numMainEventQueues > 1 || !quantumCallbacks().empty()) {
         fatal_if(simQuantum == 0,
                  "Quantum for multi-eventq simulation not specified");
 
         quantum_event.reset(
-            new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
-                                EventBase::Progress_Event_Pri, 0));
+            new QuantumEvent(curTick() + simQuantum, simQuantum,
+                             EventBase::Progress_Event_Pri, 0));
+    }
 
+    if (numMainEventQueues > 1)
         inParallelMode = true;
-    }
 
     simulatorThreads->runUntilLocalExit();
     Event *local_event = doSimLoop(mainEventQueue[0]);
@@ -38,6 +38,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <functional>
+
 #include "base/types.hh"
 
 namespace gem5
@@ -55,6 +57,15 @@ GlobalSimLoopExitEvent *simulate(Tick num_cycles = MaxTick);
  */
 void terminateEventQueueThreads();
 
+/**
+ * Register a function to run at every quantum barrier of simulate(). It
+ * runs on one thread while the threads of all other event queues wait,
+ * so it may touch the objects of every queue. With a callback registered
+ * a single queue run stops at the same quanta too, which needs a
+ * simulation quantum.
+ */
+void registerQuantumCallback(const std::function<void()> &callback);
+
 extern GlobalSimLoopExitEvent *simulate_limit_event;
 
 } // namespace gem5
@@ -0,0 +1,187 @@
+#include "sim/warm_state.hh"
+
+#include <cxxabi.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace gem5
+{
+
+namespace
+{
+
+const char warmStateMagic[] = "XSWARMST";
+
+/** Bump when the layout of any section changes. */
+const uint32_t warmStateVersion = 3;
+
+std::vector<WarmStateful *> &
+registry()
+{
+    static std::vector<WarmStateful *> objects;
+    return objects;
+}
+
+/** Registered objects in load order, ties in construction order. */
+std::vector<WarmStateful *>
+orderedObjects()
+{
+    std::vector<WarmStateful *> objects = registry();
+    std::stable_sort(objects.begin(), objects.end(),
+        [](const WarmStateful *a, const WarmStateful *b) {
+            return a->warmStateOrder() < b->warmStateOrder();
+        });
+    return objects;
+}
+
+} // anonymous namespace
+
+std::string
+WarmStateIn::getString()
+{
+    uint64_t size = get<uint64_t>();
+    fatal_if(pos + size > buf.size(),
+             "Warm state section %s is truncated.\n", section);
+    std::string str = buf.substr(pos, size);
+    pos += size;
+    return str;
+}
+
+WarmStateful::WarmStateful()
+{
+    registry().push_back(this);
+}
+
+WarmStateful::~WarmStateful()
+{
+    auto &objects = registry();
+    objects.erase(std::remove(objects.begin(), objects.end(), this),
+                  objects.end());
+}
+
+std::string
+WarmStateful::typeName(const std::type_info &type)
+{
+    int status;
+    char *demangled =
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status != 0)
+        return type.name();
+    std::string name = demangled;
+    std::free(demangled);
+    return name;
+}
+
+void
+WarmStateful::saveAll(const std::string &path)
+{
+    WarmStateOut out;
+    for (char c : std::string(warmStateMagic))
+        out.put(c);
+    out.put(warmStateVersion);
+    out.put<uint32_t>(registry().size());
+
+    for (auto *obj : orderedObjects()) {
+        WarmStateOut section;
+        obj->saveWarmState(section);
+        out.putString(obj->warmStateName());
+        out.putString(obj->warmStateGeometry());
+        out.putString(section.data());
+    }
+
+    gzFile file = gzopen(path.c_str(), "wb");
+    if (file == nullptr)
+        fatal("Can't open warm state file '%s'\n", path);
+
+    const std::string &data = out.data();
+    if (!data.empty() &&
+        gzwrite(file, data.data(), data.size()) != (int)data.size()) {
+        fatal("Write failed on warm state file '%s'\n", path);
+    }
+
+    if (gzclose(file))
+        fatal("Close failed on warm state file '%s'\n", path);
+
+    inform("Saved warm state of %d objects to %s\n", registry().size(),
+           path);
+}
+
+void
+WarmStateful::loadAll(const std::string &path)
+{
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (file == nullptr)
+        fatal("Can't open warm state file '%s'\n", path);
+
+    std::string data;
+    char chunk[16384];
+    int bytes_read;
+    while ((bytes_read = gzread(file, chunk, sizeof(chunk))) > 0)
+        data.append(chunk, bytes_read);
+    fatal_if(bytes_read < 0, "Read failed on warm state file '%s'\n", path);
+
+    if (gzclose(file))
+        fatal("Close failed on warm state file '%s'\n", path);
+
+    WarmStateIn in(path, data);
+    std::string magic;
+    for (size_t i = 0; i < sizeof(warmStateMagic) - 1; i++)
+        magic += in.get<char>();
+    fatal_if(magic != warmStateMagic, "%s is not a warm state file.\n",
+             path);
+    uint32_t version = in.get<uint32_t>();
+    fatal_if(version != warmStateVersion,
+             "Warm state file %s has version %d, expected %d.\n",
+             path, version, warmStateVersion);
+
+    // name -> (geometry, payload)
+    std::map<std::string, std::pair<std::string, std::string>> sections;
+    uint32_t num_sections = in.get<uint32_t>();
+    for (uint32_t i = 0; i < num_sections; i++) {
+        std::string name = in.getString();
+        std::string geometry = in.getString();
+        sections[name] = {geometry, in.getString()};
+    }
+
+    unsigned restored = 0, mismatched = 0, missing = 0;
+    for (auto *obj : orderedObjects()) {
+        std::string name = obj->warmStateName();
+        auto it = sections.find(name);
+        if (it == sections.end()) {
+            warn("%s: not in warm state %s, starting cold.\n", name, path);
+            missing++;
+            continue;
+        }
+
+        const auto &[geometry, payload] = it->second;
+        std::string expected = obj->warmStateGeometry();
+        if (geometry != expected) {
+            warn("%s: warm state geometry '%s' does not match '%s', "
+                 "starting cold.\n", name, geometry, expected);
+            mismatched++;
+        } else {
+            WarmStateIn section(name, payload);
+            obj->loadWarmState(section);
+            fatal_if(!section.done(),
+                     "Warm state section %s has %d unread bytes.\n",
+                     name, section.remaining());
+            restored++;
+        }
+        sections.erase(it);
+    }
+
+    for (const auto &section : sections)
+        warn("Warm state section %s has no matching object.\n",
+             section.first);
+
+    inform("Warm state %s: %d restored, %d geometry mismatches, "
+           "%d missing, %d unused.\n", path, restored, mismatched, missing,
+           sections.size());
+}
+
+} // namespace gem5
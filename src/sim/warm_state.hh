@@ -0,0 +1,139 @@
+/**
+ * @file
+ * Versioned binary snapshot of warmed microarchitectural state, such as
+ * cache tags and branch predictor tables, kept next to an architectural
+ * checkpoint so later runs from it can skip the warmup. TLBs are left
+ * out: their entries were walked after the checkpoint, against page
+ * tables the guest has not set up yet when the snapshot is loaded.
+ */
+
+#ifndef __SIM_WARM_STATE_HH__
+#define __SIM_WARM_STATE_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+/** Append-only buffer holding one section of a snapshot. */
+class WarmStateOut
+{
+  private:
+    std::string buf;
+
+  public:
+    template <typename T>
+    void
+    put(const T &value)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                      "Warm state only stores plain scalars.");
+        buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void
+    putString(const std::string &str)
+    {
+        put<uint64_t>(str.size());
+        buf.append(str);
+    }
+
+    const std::string &data() const { return buf; }
+};
+
+/** Reader over one section of a snapshot. */
+class WarmStateIn
+{
+  private:
+    const std::string &section;
+    const std::string &buf;
+    size_t pos = 0;
+
+  public:
+    WarmStateIn(const std::string &_section, const std::string &_buf)
+        : section(_section), buf(_buf)
+    {}
+
+    template <typename T>
+    T
+    get()
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                      "Warm state only stores plain scalars.");
+        fatal_if(pos + sizeof(T) > buf.size(),
+                 "Warm state section %s is truncated.\n", section);
+        T value;
+        std::memcpy(&value, buf.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    template <typename T>
+    void get(T &value) { value = get<T>(); }
+
+    std::string getString();
+
+    bool done() const { return pos == buf.size(); }
+    size_t remaining() const { return buf.size() - pos; }
+};
+
+/**
+ * An object whose warmed state is part of a snapshot. Every instance
+ * registers itself on construction, like Drainable, and owns one section
+ * of the snapshot named after it.
+ *
+ * A section only loads into an object reporting the same geometry, so a
+ * snapshot can be reused across configurations that change some
+ * structures and keep others: the rest start cold and the load reports
+ * which ones did.
+ */
+class WarmStateful
+{
+  public:
+    WarmStateful();
+    virtual ~WarmStateful();
+
+    /** Section name, normally the SimObject name. */
+    virtual std::string warmStateName() const = 0;
+
+    /** Everything the layout of the section depends on. */
+    virtual std::string warmStateGeometry() const = 0;
+
+    virtual void saveWarmState(WarmStateOut &out) const = 0;
+    virtual void loadWarmState(WarmStateIn &in) = 0;
+
+    /**
+     * Sections load in increasing order, e.g. so outer caches restore
+     * their blocks after the inner ones that allocate through them.
+     */
+    virtual int warmStateOrder() const { return 0; }
+
+    /** Readable name of a type, to describe structures in a geometry. */
+    static std::string typeName(const std::type_info &type);
+
+    template <typename T>
+    static std::string
+    typeName(const T &obj)
+    {
+        return typeName(typeid(obj));
+    }
+
+    /** Write the state of every registered object to a gzip file. */
+    static void saveAll(const std::string &path);
+
+    /**
+     * Restore every registered object from a file written by saveAll
+     * and report the sections that did not match.
+     */
+    static void loadAll(const std::string &path);
+};
+
+} // namespace gem5
+
+#endif // __SIM_WARM_STATE_HH__
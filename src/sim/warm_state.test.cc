@@ -0,0 +1,253 @@
+/**
+ * @file
+ * Round trips of warm state sections and snapshot files: values come
+ * back as written, sections load in order into the objects of the same
+ * name and geometry, and the others start cold.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/gtest/logging.hh"
+#include "sim/warm_state.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class FakeState : public WarmStateful
+{
+  public:
+    FakeState(const std::string &_name, size_t size,
+              std::vector<std::string> &_log, int _order=0)
+        : values(size), log(_log), _name(_name), order(_order)
+    {}
+
+    std::string warmStateName() const override { return _name; }
+
+    std::string
+    warmStateGeometry() const override
+    {
+        return csprintf("size=%d", values.size());
+    }
+
+    void
+    saveWarmState(WarmStateOut &out) const override
+    {
+        for (int value : values)
+            out.put(value);
+        out.putString(label);
+    }
+
+    void
+    loadWarmState(WarmStateIn &in) override
+    {
+        for (int &value : values)
+            in.get(value);
+        label = in.getString();
+        log.push_back(_name);
+    }
+
+    int warmStateOrder() const override { return order; }
+
+    std::vector<int> values;
+    std::string label;
+
+  private:
+    std::vector<std::string> &log;
+    const std::string _name;
+    const int order;
+};
+
+/** An object reading back less than it saved. */
+class ShortReader : public FakeState
+{
+  public:
+    using FakeState::FakeState;
+
+    void loadWarmState(WarmStateIn &in) override { in.get<int>(); }
+};
+
+class WarmStateTest : public testing::Test
+{
+  protected:
+    void
+    SetUp() override
+    {
+        char name[] = "/tmp/warm_state_testXXXXXX";
+        int fd = mkstemp(name);
+        ASSERT_GE(fd, 0);
+        close(fd);
+        path = name;
+    }
+
+    void TearDown() override { std::remove(path.c_str()); }
+
+    std::string path;
+    std::vector<std::string> log;
+};
+
+} // anonymous namespace
+
+/** Scalars and strings come back in the order they were written. */
+TEST(WarmStateSectionTest, RoundTrip)
+{
+    WarmStateOut out;
+    out.put<uint8_t>(200);
+    out.put<int64_t>(-5);
+    out.put(2.5);
+    out.put(true);
+    out.putString("");
+    out.putString(std::string("with\0nul", 8));
+    out.put<uint64_t>(~uint64_t(0));
+
+    const std::string name = "section";
+    WarmStateIn in(name, out.data());
+    EXPECT_EQ(in.get<uint8_t>(), 200);
+    EXPECT_EQ(in.get<int64_t>(), -5);
+    double d;
+    in.get(d);
+    EXPECT_EQ(d, 2.5);
+    EXPECT_TRUE(in.get<bool>());
+    EXPECT_EQ(in.getString(), "");
+    EXPECT_EQ(in.getString(), std::string("with\0nul", 8));
+    EXPECT_FALSE(in.done());
+    EXPECT_EQ(in.remaining(), sizeof(uint64_t));
+    EXPECT_EQ(in.get<uint64_t>(), ~uint64_t(0));
+    EXPECT_TRUE(in.done());
+}
+
+/** Reading past the end of a section is fatal. */
+TEST(WarmStateSectionTest, Truncated)
+{
+    WarmStateOut out;
+    out.put<uint16_t>(1);
+    out.putString("abc");
+
+    const std::string name = "section";
+    const std::string cut = out.data().substr(0, out.data().size() - 1);
+    WarmStateIn in(name, cut);
+    in.get<uint16_t>();
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(in.getString());
+    EXPECT_NE(gtestLogOutput.str().find("section is truncated"),
+              std::string::npos);
+
+    WarmStateIn again(name, cut);
+    again.get<uint16_t>();
+    again.get<uint64_t>();
+    again.get<uint16_t>();
+    EXPECT_ANY_THROW(again.get<uint16_t>());
+}
+
+/** Type names are readable, and those of the dynamic type. */
+TEST(WarmStateSectionTest, TypeName)
+{
+    std::vector<std::string> log;
+    FakeState fake("fake", 1, log);
+    const WarmStateful &base = fake;
+    EXPECT_EQ(WarmStateful::typeName(base),
+              "(anonymous namespace)::FakeState");
+    EXPECT_EQ(WarmStateful::typeName(typeid(int)), "int");
+}
+
+/** Every object gets its own state back, in increasing load order. */
+TEST_F(WarmStateTest, SaveAndLoad)
+{
+    FakeState a("a", 3, log, 2), b("b", 0, log, -1), c("c", 2, log, 2);
+    a.values = {1, 2, 3};
+    a.label = "first";
+    b.label = "empty";
+    c.values = {-7, 8};
+    WarmStateful::saveAll(path);
+
+    a.values = {0, 0, 0};
+    a.label.clear();
+    b.label.clear();
+    c.values = {0, 0};
+    WarmStateful::loadAll(path);
+
+    EXPECT_EQ(log, std::vector<std::string>({"b", "a", "c"}));
+    EXPECT_EQ(a.values, std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(a.label, "first");
+    EXPECT_EQ(b.label, "empty");
+    EXPECT_EQ(c.values, std::vector<int>({-7, 8}));
+}
+
+/**
+ * Objects that were not saved start cold, sections of objects that are
+ * gone are skipped, and the rest load.
+ */
+TEST_F(WarmStateTest, MissingAndUnused)
+{
+    auto *gone = new FakeState("gone", 1, log);
+    FakeState kept("kept", 2, log);
+    gone->values = {9};
+    kept.values = {1, 2};
+    WarmStateful::saveAll(path);
+    delete gone;
+
+    FakeState added("added", 1, log);
+    kept.values = {0, 0};
+    gtestLogOutput.str("");
+    WarmStateful::loadAll(path);
+
+    EXPECT_EQ(kept.values, std::vector<int>({1, 2}));
+    EXPECT_EQ(added.values, std::vector<int>({0}));
+    EXPECT_EQ(log, std::vector<std::string>({"kept"}));
+
+    const std::string output = gtestLogOutput.str();
+    EXPECT_NE(output.find("added: not in warm state"), std::string::npos);
+    EXPECT_NE(output.find("section gone has no matching object"),
+              std::string::npos);
+    EXPECT_NE(output.find("1 restored, 0 geometry mismatches, "
+                          "1 missing, 1 unused"), std::string::npos);
+}
+
+/** A section that changed geometry is not loaded. */
+TEST_F(WarmStateTest, GeometryMismatch)
+{
+    {
+        FakeState old("table", 4, log);
+        old.values = {1, 2, 3, 4};
+        WarmStateful::saveAll(path);
+    }
+
+    FakeState table("table", 2, log);
+    gtestLogOutput.str("");
+    WarmStateful::loadAll(path);
+    EXPECT_EQ(table.values, std::vector<int>({0, 0}));
+    EXPECT_TRUE(log.empty());
+    EXPECT_NE(gtestLogOutput.str().find(
+                  "geometry 'size=4' does not match 'size=2'"),
+              std::string::npos);
+}
+
+/** Leaving part of a section unread is fatal. */
+TEST_F(WarmStateTest, UnreadBytes)
+{
+    ShortReader reader("reader", 2, log);
+    WarmStateful::saveAll(path);
+    EXPECT_ANY_THROW(WarmStateful::loadAll(path));
+}
+
+/** Files that are not snapshots are refused. */
+TEST_F(WarmStateTest, BadMagic)
+{
+    FILE *file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a warm state file", file);
+    std::fclose(file);
+
+    FakeState fake("fake", 1, log);
+    EXPECT_ANY_THROW(WarmStateful::loadAll(path));
+    EXPECT_TRUE(log.empty());
+}
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Reader for the binary stats format written by bin:// stat outputs (see
+src/base/stats/binary.hh for the layout of the file).
+
+The reader does not depend on gem5, so it can be used from any Python
+installation with util/ on its path:
+
+    from binary_stats import read_frame
+    frame = read_frame("m5out/stats.bin")
+
+or run as a script to convert a file to CSV:
+
+    python3 util/binary_stats.py m5out/stats.bin > stats.csv
+"""
+
+import struct
+import zlib
+
+MAGIC = b"gem5sbin"
+
+
+class _Buffer:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            byte = self.data[self.pos]
+            self.pos += 1
+            value |= (byte & 0x7F) << shift
+            if byte < 0x80:
+                return value
+            shift += 7
+
+    def bytes(self, size):
+        chunk = self.data[self.pos : self.pos + size]
+        if len(chunk) != size:
+            raise EOFError("truncated stats record")
+        self.pos += size
+        return chunk
+
+
+def _records(data):
+    buf = _Buffer(data)
+    if buf.bytes(len(MAGIC)) != MAGIC:
+        raise ValueError("not a binary stats file")
+
+    while buf.pos < len(data):
+        try:
+            tag = buf.bytes(1)
+            raw_size = buf.varint()
+            packed = buf.bytes(buf.varint())
+        except (EOFError, IndexError):
+            # The simulator was stopped in the middle of a record
+            return
+        payload = zlib.decompress(packed)
+        assert len(payload) == raw_size
+        yield tag, _Buffer(payload)
+
+
+def iter_dumps(path):
+    """Yield (tick, names, values) for every dump in the file.
+
+    names is shared between dumps with the same schema, values is a new
+    list for every dump.
+    """
+
+    with open(path, "rb") as f:
+        data = f.read()
+
+    names = []
+    values = []
+    for tag, rec in _records(data):
+        if tag == b"S":
+            names = [
+                rec.bytes(rec.varint()).decode()
+                for _ in range(rec.varint())
+            ]
+            values = [0] * len(names)
+        elif tag == b"D":
+            tick = rec.varint()
+            values = list(values)
+            col = 0
+            for _ in range(rec.varint()):
+                head = rec.varint()
+                col += head >> 1
+                if head & 1:
+                    (values[col],) = struct.unpack("<d", rec.bytes(8))
+                else:
+                    delta = rec.varint()
+                    delta = (delta >> 1) ^ -(delta & 1)
+                    values[col] = int(values[col]) + delta
+                col += 1
+            yield tick, names, values
+        else:
+            raise ValueError(f"unknown stats record {tag!r}")
+
+
+def read_frame(path):
+    """Read all dumps into a pandas DataFrame indexed by tick.
+
+    Stats that were not part of a dump are NaN in its row.
+    """
+
+    import pandas
+
+    ticks = []
+    rows = []
+    for tick, names, values in iter_dumps(path):
+        ticks.append(tick)
+        rows.append(dict(zip(names, values)))
+    return pandas.DataFrame(rows, index=pandas.Index(ticks, name="tick"))
+
+
+if __name__ == "__main__":
+    import sys
+
+    if len(sys.argv) != 2:
+        sys.exit(f"usage: {sys.argv[0]} STATS_FILE")
+    read_frame(sys.argv[1]).to_csv(sys.stdout)
@@ -0,0 +1,189 @@
+#! /usr/bin/env python3
+
+"""Convert the binary pipeline trace written by an O3 cpu with
+pipe_trace_file set (--pipe-trace in xiangshan.py) to
+
+  pipeview: the O3PipeView debug flag output, for util/o3-pipeview.py
+  konata:   the Kanata log format read by the Konata pipeline viewer
+
+The file layout is described in src/cpu/o3/pipe_trace.hh.
+"""
+
+import argparse
+import gzip
+import heapq
+import struct
+import sys
+
+MAGIC = b'XSPIPETR'
+VERSION = 1
+
+# Same order as StallReason in src/cpu/o3/comm.hh
+STALL_REASONS = [
+    'NoStall', 'IcacheStall', 'ITlbStall', 'DTlbStall', 'BpStall',
+    'IntStall', 'TrapStall', 'FragStall', 'SquashStall',
+    'FetchBufferInvalid', 'InstMisPred', 'InstSquashed', 'SerializeStall',
+    'ScalarLongExecute', 'VectorLongExecute', 'InstNotReady',
+    'LoadL1Bound', 'LoadL2Bound', 'LoadL3Bound', 'LoadMemBound',
+    'StoreL1Bound', 'StoreL2Bound', 'StoreL3Bound', 'StoreMemBound',
+    'MemSquashed', 'MemNotReady', 'MemCommitRateLimit', 'Atomic',
+    'OtherMemStall', 'MemDQBandwidth', 'IntDQBandwidth', 'FVDQBandwidth',
+    'VectorReadyButNotIssued', 'ScalarReadyButNotIssued', 'ResumeUnblock',
+    'CommitSquash', 'OtherStall', 'OtherFetchStall',
+]
+
+NO_IQ = 0xff
+
+STAGES = ['decode', 'rename', 'dispatch', 'issue', 'complete', 'commit']
+
+HEADER = struct.Struct('<8sIIQ')
+DISASM = struct.Struct('<QHH')
+IQ_NAME = struct.Struct('<BH')
+INST = struct.Struct('<QQHBBQ6i')
+
+
+def open_trace(path):
+    with open(path, 'rb') as f:
+        gzipped = f.read(2) == b'\x1f\x8b'
+    return gzip.open(path, 'rb') if gzipped else open(path, 'rb')
+
+
+def read_exact(trace, size):
+    data = trace.read(size)
+    if len(data) != size:
+        sys.exit('Truncated pipeline trace')
+    return data
+
+
+class Inst:
+    __slots__ = ['sn', 'pc', 'upc', 'iq', 'stall', 'fetch', 'ticks',
+                 'disasm']
+
+
+def read_trace(trace):
+    """Yield the clock period, then every instruction in commit order."""
+    magic, version, num_stalls, period = \
+        HEADER.unpack(read_exact(trace, HEADER.size))
+    if magic != MAGIC:
+        sys.exit('Not a pipeline trace')
+    if version != VERSION:
+        sys.exit('Pipeline trace version %d, expected %d' %
+                 (version, VERSION))
+    if num_stalls != len(STALL_REASONS):
+        print('Warning: the trace has %d stall reasons, expected %d' %
+              (num_stalls, len(STALL_REASONS)), file=sys.stderr)
+    yield period
+
+    disasms = {}
+    iq_names = {NO_IQ: '-'}
+    while True:
+        kind = trace.read(1)
+        if not kind:
+            return
+        if kind == b'D':
+            pc, upc, length = DISASM.unpack(read_exact(trace, DISASM.size))
+            disasms[(pc, upc)] = read_exact(trace, length).decode()
+        elif kind == b'Q':
+            iq, length = IQ_NAME.unpack(read_exact(trace, IQ_NAME.size))
+            iq_names[iq] = read_exact(trace, length).decode()
+        elif kind == b'I':
+            fields = INST.unpack(read_exact(trace, INST.size))
+            inst = Inst()
+            (inst.sn, inst.pc, inst.upc, iq, stall, inst.fetch) = fields[:6]
+            # absolute ticks, None for skipped stages
+            inst.ticks = [inst.fetch + t if t != -1 else None
+                          for t in fields[6:]]
+            inst.iq = iq_names.get(iq, str(iq))
+            inst.stall = (STALL_REASONS[stall]
+                          if stall < len(STALL_REASONS) else str(stall))
+            inst.disasm = disasms.get((inst.pc, inst.upc), '?')
+            yield inst
+        else:
+            sys.exit('Unknown record type %r in pipeline trace' % kind)
+
+
+def to_pipeview(insts, out):
+    for inst in insts:
+        out.write('O3PipeView:fetch:%d:0x%08x:%d:%d:%s\n' %
+                  (inst.fetch, inst.pc, inst.upc, inst.sn, inst.disasm))
+        for stage, tick in zip(STAGES[:-1], inst.ticks[:-1]):
+            out.write('O3PipeView:%s:%d\n' % (stage, tick or 0))
+        out.write('O3PipeView:retire:%d:store:0\n' % (inst.ticks[-1] or 0))
+
+
+KONATA_STAGES = ['F', 'Dc', 'Rn', 'Ds', 'Is', 'Cm']
+
+
+def to_konata(insts, period, out):
+    out.write('Kanata\t0004\n')
+    # (cycle, order, line); committed instructions are fetched in order,
+    # so nothing later in the trace happens before the current fetch
+    pending = []
+    order = 0
+    cycle = None
+    retired = 0
+
+    def emit_until(limit):
+        nonlocal cycle
+        while pending and (limit is None or pending[0][0] < limit):
+            at, _, line = heapq.heappop(pending)
+            if cycle is None:
+                out.write('C=\t%d\n' % at)
+            elif at != cycle:
+                out.write('C\t%d\n' % (at - cycle))
+            cycle = at
+            out.write(line)
+
+    for kid, inst in enumerate(insts):
+        fetch = inst.fetch // period
+        emit_until(fetch)
+
+        events = [(fetch, 'I\t%d\t%d\t0\n' % (kid, inst.sn)),
+                  (fetch, 'L\t%d\t0\t%x: %s\n' % (kid, inst.pc, inst.disasm)),
+                  (fetch, 'L\t%d\t1\tsn %d iq %s stall %s\n' %
+                   (kid, inst.sn, inst.iq, inst.stall))]
+        starts = [('F', fetch)] + \
+            [(name, tick // period)
+             for name, tick in zip(KONATA_STAGES[1:], inst.ticks[:-1])
+             if tick is not None]
+        for (name, start), (_, end) in zip(starts, starts[1:] + [(None,
+                inst.ticks[-1] // period)]):
+            events.append((start, 'S\t%d\t0\t%s\n' % (kid, name)))
+            events.append((max(start, end), 'E\t%d\t0\t%s\n' % (kid, name)))
+        end = inst.ticks[-1] // period
+        events.append((end, 'R\t%d\t%d\t0\n' % (kid, retired)))
+        retired += 1
+
+        for at, line in events:
+            heapq.heappush(pending, (at, order, line))
+            order += 1
+
+    emit_until(None)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-f', '--format', choices=['pipeview', 'konata'],
+                        default='konata', help="output format")
+    parser.add_argument('-o', dest='outfile', default='-',
+                        help="output file, - for stdout")
+    parser.add_argument('tracefile')
+    args = parser.parse_args()
+
+    with open_trace(args.tracefile) as trace:
+        records = read_trace(trace)
+        period = next(records)
+        out = sys.stdout if args.outfile == '-' else open(args.outfile, 'w')
+        try:
+            if args.format == 'pipeview':
+                to_pipeview(records, out)
+            else:
+                to_konata(records, period, out)
+        finally:
+            if out is not sys.stdout:
+                out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,28 @@
+#!/usr/bin/env bash
+
+# Run a checkpoint with and without --idle-cycle-skip and check that the
+# simulated stats match. Only the host stats and the count of skipped
+# cycles may differ.
+
+script_dir=$(dirname -- "$( readlink -f -- "$0"; )")
+source $script_dir/common.sh
+
+for var in GCBV_REF_SO GCB_RESTORER gem5_home; do
+    checkForVariable $var
+done
+
+$gem5 -d noskip $gem5_home/configs/example/xiangshan.py \
+    --generic-rv-cpt=$1 || exit 1
+$gem5 -d skip $gem5_home/configs/example/xiangshan.py \
+    --generic-rv-cpt=$1 --idle-cycle-skip || exit 1
+
+function simStats() {
+    grep -v -E '^(host[A-Za-z]+|[^ ]*\.skippedCycles) ' $1/stats.txt
+}
+
+if ! grep -q -E '\.skippedCycles +[1-9]' skip/stats.txt; then
+    echo "No cycles were skipped, the comparison is void"
+    exit 1
+fi
+
+diff -u <(simStats noskip) <(simStats skip)
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+
+script_dir=$(dirname -- "$( readlink -f -- "$0"; )")
+source $script_dir/common.sh
+
+for var in GCB_MULTI_CORE_RESTORER gem5_home; do
+    checkForVariable $var
+done
+
+# Each core runs on its own host thread, the L3 and memory on another.
+# Difftest is off. Replace --parallel-eventqs with --eventq-boundaries-only
+# to get the serial reference run, whose stats must match;
+# parallel_eventq_regression.sh compares the two.
+$gem5 $gem5_home/configs/example/xiangshan.py --num-cpus=2 --generic-rv-cpt=$1 \
+    --parallel-eventqs --sim-quantum=${sim_quantum:-1ns}
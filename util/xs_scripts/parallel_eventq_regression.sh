@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+
+# Run a checkpoint with the per-core event queue boundaries on one event
+# queue and on parallel event queues, at the same quantum, and check that
+# the simulated stats match. Only the host stats may differ. The quantum
+# defaults to one tick, which makes a barrier of every tick, so the runs
+# are cut short.
+#
+# Usage: parallel_eventq_regression.sh <checkpoint> [num cpus] [quantum]
+#            [max insts]
+
+script_dir=$(dirname -- "$( readlink -f -- "$0"; )")
+source $script_dir/common.sh
+
+num_cpus=${2:-1}
+quantum=${3:-1ps}
+max_insts=${4:-200000}
+
+if [ $num_cpus -gt 1 ]; then
+    checkForVariable GCB_MULTI_CORE_RESTORER
+else
+    checkForVariable GCB_RESTORER
+fi
+checkForVariable gem5_home
+
+$gem5 -d serial $gem5_home/configs/example/xiangshan.py \
+    --generic-rv-cpt=$1 --num-cpus=$num_cpus --maxinsts=$max_insts \
+    --eventq-boundaries-only --sim-quantum=$quantum || exit 1
+$gem5 -d parallel $gem5_home/configs/example/xiangshan.py \
+    --generic-rv-cpt=$1 --num-cpus=$num_cpus --maxinsts=$max_insts \
+    --parallel-eventqs --sim-quantum=$quantum || exit 1
+
+function simStats() {
+    grep -v -E '^host[A-Za-z]+ ' $1/stats.txt
+}
+
+diff -u <(simStats serial) <(simStats parallel)
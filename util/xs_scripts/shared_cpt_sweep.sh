@@ -0,0 +1,106 @@
+# DO NOT track your local updates in this script!
+
+function print_help() {
+    printf "Usage:
+    bash $0 checkpoint config_list.lst task_tag\n"
+    exit 1
+}
+
+if [[ -z "$3" ]]; then   # $3 is not set
+    echo "Arguments not provided!"
+    print_help
+fi
+
+set -x
+
+script_dir=$(dirname -- "$( readlink -f -- "$0"; )")
+source $script_dir/common.sh
+
+for var in GCBV_REF_SO GCB_RESTORER gem5_home; do
+    checkForVariable $var
+done
+
+# Runs every config of the list on the same checkpoint at the same time.
+# The checkpoint is decompressed only once, into a shared memory segment,
+# and every run maps that segment copy-on-write: pages a run does not write
+# are shared by all of them. All configs must use the same memory layout.
+export checkpoint=`realpath $1`
+
+# Note 1: each line of the config list holds a config name followed by the
+# extra options of xiangshan.py for that config, looks like:
+#       base
+#       no_l3 --no-l3cache
+#       small_ftb --param 'system.cpu[0].branchPred.ftb.numEntries=1024'
+export config_list=`realpath $2`
+
+export tag=$3
+
+export log_file='log.txt'
+
+export ds=$(pwd)  # data storage. It is specific for BOSC machines, you can ignore it
+export full_work_dir=$ds/$tag # work dir wheter stats data stored
+mkdir -p $full_work_dir
+
+# The segment lives in /dev/shm until this script exits
+export segment=xs_cpt_${tag}_$$
+
+trap "rm -f /dev/shm/$segment" EXIT
+
+trap cleanup SIGINT
+
+function cleanup() {
+    echo "Script interrupted, marking tasks as aborted..."
+    find $full_work_dir -type f -name running -execdir bash -c 'rm -f running; touch abort' \;
+    exit 1
+}
+
+function populate() {
+    mkdir -p $full_work_dir/populate
+    cd $full_work_dir/populate
+    $gem5 $gem5_home/configs/example/xiangshan.py \
+        --generic-rv-cpt=$checkpoint --populate-shared-cpt=$segment \
+        >$log_file 2>&1
+}
+
+function run_config() {
+    set -x
+    read -r name args <<< "$1"
+
+    work_dir=$full_work_dir/$name
+    mkdir -p $work_dir
+    cd $work_dir
+
+    if test -f "completed"; then
+        echo "Already completed; skip $name"
+        return
+    fi
+
+    rm -f abort
+    rm -f completed
+
+    touch running
+
+    eval $gem5 $gem5_home/configs/example/xiangshan.py \
+        --generic-rv-cpt=$checkpoint --map-shared-cpt=$segment $args \
+        >$log_file 2>&1
+    if [ $? -ne 0 ]; then
+        echo FAIL
+        rm running
+        touch abort
+        return
+    fi
+
+    rm running
+    touch completed
+}
+
+export -f run_config
+
+if ! populate; then
+    echo "Failed to restore $checkpoint into /dev/shm/$segment"
+    exit 1
+fi
+
+# We use gnu parallel to control the parallelism.
+export num_threads=63
+grep -v '^\s*$' $config_list | parallel -a - -j $num_threads run_config {}